@@ -0,0 +1,60 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <avx2-transform-options.h>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // A transformation of an unpacked input vector by a matrix into an
+    // output vector. The matrix and the output must outlive the job.
+    struct TransformJob
+    {
+        const SOAMatrix * matrix;
+        std::vector<float> input;
+        AVXVector * output;
+    };
+
+    // Transforms submitted jobs asynchronously on a persistent pool of
+    // threads. The jobs pass a pipeline of two stages: one thread packs the
+    // inputs into AVX vectors, while the kernel workers transform the
+    // packed inputs, so that packing the input of the next job overlaps
+    // with the transformation of the current one. The destructor finishes
+    // all submitted jobs.
+    class AsyncTransformer
+    {
+      public:
+        // Called with the result of a job on one of the kernel workers.
+        using Completion = std::function<void(AVXVector)>;
+
+        explicit AsyncTransformer(
+            const std::size_t kernelWorkers = 1,
+            const TransformOptions & options = TransformOptions{}) noexcept;
+        ~AsyncTransformer() noexcept;
+
+        AsyncTransformer(const AsyncTransformer &) = delete;
+        AsyncTransformer & operator=(const AsyncTransformer &) = delete;
+
+        // The future becomes ready once the output of the job is written.
+        std::future<void> submit(TransformJob job) noexcept;
+
+        std::future<AVXVector> submit(const SOAMatrix & matrix,
+                                      std::vector<float> input) noexcept;
+
+        void submit(const SOAMatrix & matrix, std::vector<float> input,
+                    Completion completion) noexcept;
+
+      private:
+        struct Pipeline;
+
+        std::unique_ptr<Pipeline> _pipeline;
+        std::thread _packer;
+        std::vector<std::thread> _kernelWorkers;
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace matrixmultiplication::avx2
+{
+    // Bounds how long and how many requests a TransformCoalescer gathers
+    // before it transforms them as one batch.
+    struct CoalescingWindow
+    {
+        std::chrono::microseconds maxDelay{100};
+        std::size_t maxBatch{16};
+    };
+
+    struct CoalescingStats
+    {
+        std::size_t requests;
+        std::size_t batches;
+    };
+
+    // Coalesces concurrent single-vector transformations by one matrix into
+    // micro-batches. A dispatcher thread gathers the requests of all calling
+    // threads within the window, transforms them with one pass over the
+    // matrix and hands each caller its own result. The matrix must outlive
+    // the coalescer.
+    class TransformCoalescer
+    {
+        struct Request;
+
+        const SOAMatrix & _matrix;
+        CoalescingWindow _window;
+
+        std::mutex _mutex;
+        std::condition_variable _requested;
+        std::deque<Request *> _pending;
+        bool _stopping{false};
+        CoalescingStats _stats{0, 0};
+
+        std::thread _dispatcher;
+
+        void dispatch() noexcept;
+
+      public:
+        explicit TransformCoalescer(
+            const SOAMatrix & matrix,
+            const CoalescingWindow & window = CoalescingWindow{}) noexcept;
+        ~TransformCoalescer() noexcept;
+
+        TransformCoalescer(const TransformCoalescer &) = delete;
+        TransformCoalescer & operator=(const TransformCoalescer &) = delete;
+
+        // Blocks the calling thread until the batch with its request was
+        // transformed.
+        AVXVector transform(const AVXVector & inputVector) noexcept;
+
+        CoalescingStats stats() noexcept;
+    };
+}
@@ -0,0 +1,138 @@
+#include "avx2-async.h"
+#include "blocking-queue.h"
+
+#include <avx2-variant.h>
+
+#include <cassert>
+#include <limits>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        struct UnpackedJob
+        {
+            const SOAMatrix * matrix;
+            vector<float> input;
+            AsyncTransformer::Completion completion;
+        };
+
+        struct PackedJob
+        {
+            const SOAMatrix * matrix;
+            AVXVector input;
+            AsyncTransformer::Completion completion;
+        };
+
+        AVXVector pack(const vector<float> & input) noexcept
+        {
+            AVXVector packed(input.size());
+            for (size_t i{0}; i < input.size(); ++i)
+            {
+                packed.at(i) = input[i];
+            }
+            return packed;
+        }
+    }
+
+    struct AsyncTransformer::Pipeline
+    {
+        TransformOptions options;
+
+        // The submissions never block, while the packed jobs are bounded,
+        // so that the packer runs only a few jobs ahead of the kernels.
+        BlockingQueue<UnpackedJob> submitted{numeric_limits<size_t>::max()};
+        BlockingQueue<PackedJob> packed;
+
+        Pipeline(const TransformOptions & transformOptions,
+                 const size_t packedCapacity) noexcept
+            : options(transformOptions), packed(packedCapacity)
+        {
+        }
+
+        void runPacker() noexcept
+        {
+            while (auto job = this->submitted.pop())
+            {
+                this->packed.push(PackedJob{job->matrix, pack(job->input),
+                                            move(job->completion)});
+            }
+            this->packed.close();
+        }
+
+        void runKernel() noexcept
+        {
+            while (auto job = this->packed.pop())
+            {
+                job->completion(
+                    transform(*job->matrix, job->input, this->options));
+            }
+        }
+    };
+
+    AsyncTransformer::AsyncTransformer(
+        const size_t kernelWorkers, const TransformOptions & options) noexcept
+        : _pipeline(make_unique<Pipeline>(options, kernelWorkers + 1))
+    {
+        assert(kernelWorkers > 0);
+
+        this->_packer = thread{[this]() { this->_pipeline->runPacker(); }};
+        for (size_t i{0}; i < kernelWorkers; ++i)
+        {
+            this->_kernelWorkers.emplace_back(
+                [this]() { this->_pipeline->runKernel(); });
+        }
+    }
+
+    AsyncTransformer::~AsyncTransformer() noexcept
+    {
+        // Closing the submissions lets the packer close the packed jobs
+        // after the last one, which in turn ends the kernel workers.
+        this->_pipeline->submitted.close();
+        this->_packer.join();
+        for (auto && kernelWorker : this->_kernelWorkers)
+        {
+            kernelWorker.join();
+        }
+    }
+
+    future<void> AsyncTransformer::submit(TransformJob job) noexcept
+    {
+        assert(job.matrix != nullptr && job.output != nullptr);
+
+        auto promise = make_shared<std::promise<void>>();
+        auto result = promise->get_future();
+
+        const auto output = job.output;
+        this->submit(*job.matrix, move(job.input),
+                     [output, promise](AVXVector resultVector) {
+                         *output = move(resultVector);
+                         promise->set_value();
+                     });
+        return result;
+    }
+
+    future<AVXVector> AsyncTransformer::submit(const SOAMatrix & matrix,
+                                               vector<float> input) noexcept
+    {
+        auto promise = make_shared<std::promise<AVXVector>>();
+        auto result = promise->get_future();
+
+        this->submit(matrix, move(input), [promise](AVXVector resultVector) {
+            promise->set_value(move(resultVector));
+        });
+        return result;
+    }
+
+    void AsyncTransformer::submit(const SOAMatrix & matrix,
+                                  vector<float> input,
+                                  Completion completion) noexcept
+    {
+        assert(input.size() == matrix.columns());
+
+        this->_pipeline->submitted.push(
+            UnpackedJob{&matrix, move(input), move(completion)});
+    }
+}
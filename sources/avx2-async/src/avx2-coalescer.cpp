@@ -0,0 +1,118 @@
+#include "avx2-coalescer.h"
+
+#include <avx2-batch.h>
+
+#include <algorithm>
+#include <cassert>
+#include <future>
+#include <vector>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    struct TransformCoalescer::Request
+    {
+        const AVXVector * inputVector;
+        chrono::steady_clock::time_point arrival;
+        promise<AVXVector> result;
+    };
+
+    TransformCoalescer::TransformCoalescer(
+        const SOAMatrix & matrix, const CoalescingWindow & window) noexcept
+        : _matrix(matrix), _window(window)
+    {
+        assert(window.maxBatch > 0);
+
+        this->_dispatcher = thread{[this]() { this->dispatch(); }};
+    }
+
+    TransformCoalescer::~TransformCoalescer() noexcept
+    {
+        {
+            lock_guard<mutex> lock{this->_mutex};
+            this->_stopping = true;
+        }
+        this->_requested.notify_one();
+        this->_dispatcher.join();
+    }
+
+    AVXVector TransformCoalescer::transform(
+        const AVXVector & inputVector) noexcept
+    {
+        assert(inputVector.size() == this->_matrix.columns());
+
+        Request request{&inputVector, chrono::steady_clock::now(), {}};
+        auto result = request.result.get_future();
+        {
+            lock_guard<mutex> lock{this->_mutex};
+            this->_pending.push_back(&request);
+        }
+        this->_requested.notify_one();
+
+        return result.get();
+    }
+
+    CoalescingStats TransformCoalescer::stats() noexcept
+    {
+        lock_guard<mutex> lock{this->_mutex};
+        return this->_stats;
+    }
+
+    void TransformCoalescer::dispatch() noexcept
+    {
+        vector<Request *> batch;
+        vector<const AVXVector *> inputVectors;
+
+        unique_lock<mutex> lock{this->_mutex};
+        while (true)
+        {
+            this->_requested.wait(lock, [this]() {
+                return !this->_pending.empty() || this->_stopping;
+            });
+            if (this->_pending.empty())
+            {
+                return;
+            }
+
+            // The window opens with the oldest request, so that no request
+            // waits longer than the maximum delay for its batch to start.
+            const auto deadline =
+                this->_pending.front()->arrival + this->_window.maxDelay;
+            this->_requested.wait_until(lock, deadline, [this]() {
+                return this->_pending.size() >= this->_window.maxBatch ||
+                       this->_stopping;
+            });
+
+            const auto batchSize =
+                min(this->_pending.size(), this->_window.maxBatch);
+            batch.assign(this->_pending.begin(),
+                         this->_pending.begin() +
+                             static_cast<ptrdiff_t>(batchSize));
+            this->_pending.erase(this->_pending.begin(),
+                                 this->_pending.begin() +
+                                     static_cast<ptrdiff_t>(batchSize));
+            this->_stats.requests += batchSize;
+            ++this->_stats.batches;
+
+            lock.unlock();
+
+            inputVectors.clear();
+            for (auto request : batch)
+            {
+                inputVectors.push_back(request->inputVector);
+            }
+
+            auto results = transformBatch(this->_matrix, inputVectors);
+            for (size_t b{0}; b < batch.size(); ++b)
+            {
+                // The request lives on the stack of its caller, which may
+                // return as soon as the value is set.
+                auto result = move(batch[b]->result);
+                result.set_value(move(results[b]));
+            }
+
+            lock.lock();
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace matrixmultiplication::avx2
+{
+    // A bounded multi-producer multi-consumer queue between the stages of
+    // the pipeline. Closing it lets the consumers drain the remaining items
+    // before they see the end.
+    template <typename T> class BlockingQueue
+    {
+        std::size_t _capacity;
+        std::deque<T> _items;
+        bool _closed{false};
+        std::mutex _mutex;
+        std::condition_variable _notEmpty;
+        std::condition_variable _notFull;
+
+      public:
+        explicit BlockingQueue(const std::size_t capacity) noexcept
+            : _capacity(capacity)
+        {
+        }
+
+        // Blocks while the queue is full.
+        void push(T item) noexcept
+        {
+            {
+                std::unique_lock<std::mutex> lock{this->_mutex};
+                this->_notFull.wait(lock, [this]() {
+                    return this->_items.size() < this->_capacity;
+                });
+                this->_items.push_back(std::move(item));
+            }
+            this->_notEmpty.notify_one();
+        }
+
+        // Blocks while the queue is empty, and returns nothing once it is
+        // closed and drained.
+        std::optional<T> pop() noexcept
+        {
+            std::optional<T> item;
+            {
+                std::unique_lock<std::mutex> lock{this->_mutex};
+                this->_notEmpty.wait(lock, [this]() {
+                    return !this->_items.empty() || this->_closed;
+                });
+                if (this->_items.empty())
+                {
+                    return std::nullopt;
+                }
+
+                item.emplace(std::move(this->_items.front()));
+                this->_items.pop_front();
+            }
+            this->_notFull.notify_one();
+            return item;
+        }
+
+        void close() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock{this->_mutex};
+                this->_closed = true;
+            }
+            this->_notEmpty.notify_all();
+        }
+    };
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <avx2-packed-model.h>
+#include <avx2-plan.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace matrixmultiplication::autotune
+{
+    // The transformation variants the planner chooses from.
+    enum class Kernel
+    {
+        TRANSFORM,
+        TRANSFORM_MULTI_THREADED,
+        PACKED,
+        PACKED_MULTI_THREADED,
+
+        // transformBatch, which streams the matrix once for all input
+        // vectors. Only a candidate for batches of more than one.
+        BATCH
+    };
+
+    // One configuration of the tunables of a kernel. The tunables that the
+    // kernel does not use stay zero.
+    struct TuningChoice
+    {
+        Kernel kernel{Kernel::TRANSFORM};
+
+        // The count of OpenMP threads of the multi-threaded kernels.
+        std::size_t threads{0};
+
+        // The blocking of the packed kernels.
+        std::size_t rowPanelPacks{0};
+        std::size_t columnPanelColumns{0};
+
+        // The prefetch distance of the transform kernel.
+        std::size_t prefetchDistance{0};
+
+        // The shortest time of a call measured while tuning.
+        double nanoseconds{0.0};
+    };
+
+    // The name of the kernel in the tuning file.
+    const char * kernelName(const Kernel kernel) noexcept;
+
+    // A transformation by one matrix with the kernel and tunables fixed by
+    // the planner. Repacks the matrix once if the kernel is a packed one, so
+    // that later changes to the matrix require a new plan. The multi-threaded
+    // kernels run with the count of threads of the choice without changing
+    // the OpenMP default. The matrix must outlive the plan.
+    class TunedTransform
+    {
+        const avx2::SOAMatrix * _matrix;
+        std::unique_ptr<avx2::PackedMatrix> _packed;
+        std::unique_ptr<avx2::TransformPlan> _plan;
+        TuningChoice _choice;
+
+      public:
+        TunedTransform(const avx2::SOAMatrix & matrix,
+                       const TuningChoice & choice) noexcept;
+
+        const TuningChoice & choice() const noexcept;
+
+        // Transforms the input vector into the given result of R elements.
+        // A plan for batches transforms single vectors by transform.
+        void transform(const avx2::AVXVector & input,
+                       avx2::AVXVector & result) const noexcept;
+
+        // Transforms each of the input vectors.
+        std::vector<avx2::AVXVector> transform(
+            const std::vector<const avx2::AVXVector *> & inputs)
+            const noexcept;
+    };
+
+    // Chooses the fastest configuration per shape of matrix and count of
+    // input vectors by timing the candidates on the first use of the shape.
+    // The winners are kept in a tab-separated tuning file per CPU model, so
+    // that later processes on the same host skip the search. Failing to
+    // read or write the file only costs the search.
+    class Planner
+    {
+        using Shape = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+        std::string _tuningFile;
+        std::size_t _repetitions;
+        std::size_t _tuningRuns{0};
+        std::map<Shape, TuningChoice> _choices;
+
+        // The lines of the tuning file for other CPU models, which are
+        // written back unchanged.
+        std::vector<std::string> _foreignLines;
+
+      public:
+        // Loads the choices for the executing CPU model from the tuning
+        // file. Each candidate is timed for the given count of repetitions.
+        explicit Planner(const std::string & tuningFile,
+                         const std::size_t repetitions = 5) noexcept;
+
+        // Returns the plan for the matrix and the count of input vectors
+        // per call, which tunes the shape and saves the tuning file if the
+        // shape has not been tuned yet.
+        TunedTransform plan(const avx2::SOAMatrix & matrix,
+                            const std::size_t batch = 1) noexcept;
+
+        // Returns the choice for the shape, which tunes it if necessary.
+        const TuningChoice & choose(const avx2::SOAMatrix & matrix,
+                                    const std::size_t batch = 1) noexcept;
+
+        // The count of shapes tuned by this planner.
+        std::size_t tuningRuns() const noexcept;
+
+      private:
+        void save() const noexcept;
+    };
+
+    // The tuning file named by the environment variable AVX2_TUNING_FILE,
+    // or avx2-tuning.tsv in the working directory.
+    std::string defaultTuningFile() noexcept;
+}
@@ -0,0 +1,366 @@
+#include "avx2-autotune.h"
+
+#include <avx2-batch.h>
+#include <avx2-packed.h>
+#include <avx2-plan.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+#include <host-info.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::autotune
+{
+    namespace
+    {
+        constexpr array<Kernel, 5> KERNELS{
+            Kernel::TRANSFORM, Kernel::TRANSFORM_MULTI_THREADED,
+            Kernel::PACKED, Kernel::PACKED_MULTI_THREADED, Kernel::BATCH};
+
+        bool isMultiThreaded(const Kernel kernel) noexcept
+        {
+            return kernel == Kernel::TRANSFORM_MULTI_THREADED ||
+                   kernel == Kernel::PACKED_MULTI_THREADED;
+        }
+
+        bool isPacked(const Kernel kernel) noexcept
+        {
+            return kernel == Kernel::PACKED ||
+                   kernel == Kernel::PACKED_MULTI_THREADED;
+        }
+
+        // The candidates for the shape. The multi-threaded kernels are tried
+        // with the powers of two up to the OpenMP default count of threads
+        // and with that count itself.
+        vector<TuningChoice> candidates(const size_t columns,
+                                        const size_t batch) noexcept
+        {
+            vector<size_t> threadCounts;
+            const auto maxThreads = static_cast<size_t>(omp_get_max_threads());
+            for (size_t threads{2}; threads < maxThreads; threads *= 2)
+            {
+                threadCounts.push_back(threads);
+            }
+            if (maxThreads > 1)
+            {
+                threadCounts.push_back(maxThreads);
+            }
+
+            vector<PackedBlocking> blockings{
+                {PACKED_MAX_ROW_PANEL_PACKS / 2, 0},
+                {PACKED_MAX_ROW_PANEL_PACKS, 0}};
+            if (columns > 512)
+            {
+                blockings.push_back({PACKED_MAX_ROW_PANEL_PACKS, 512});
+            }
+
+            vector<TuningChoice> result;
+            for (const size_t prefetchDistance : {0, 16})
+            {
+                result.push_back(
+                    {Kernel::TRANSFORM, 0, 0, 0, prefetchDistance});
+            }
+            for (const auto threads : threadCounts)
+            {
+                result.push_back(
+                    {Kernel::TRANSFORM_MULTI_THREADED, threads, 0, 0, 0});
+            }
+            for (const auto & blocking : blockings)
+            {
+                result.push_back({Kernel::PACKED, 0, blocking.rowPanelPacks,
+                                  blocking.columnPanelColumns, 0});
+                for (const auto threads : threadCounts)
+                {
+                    result.push_back({Kernel::PACKED_MULTI_THREADED, threads,
+                                      blocking.rowPanelPacks,
+                                      blocking.columnPanelColumns, 0});
+                }
+            }
+            if (batch > 1)
+            {
+                result.push_back({Kernel::BATCH, 0, 0, 0, 0});
+            }
+            return result;
+        }
+
+        // The shortest time of the given count of calls after one call to
+        // warm up the caches and the thread pool.
+        template <typename Call>
+        double measureMinimum(const size_t repetitions, Call && call) noexcept
+        {
+            call();
+
+            auto minimum = numeric_limits<double>::max();
+            for (size_t repetition{0}; repetition < repetitions; ++repetition)
+            {
+                const auto start = chrono::steady_clock::now();
+                call();
+                const auto stop = chrono::steady_clock::now();
+                minimum = min(
+                    minimum,
+                    chrono::duration<double, nano>(stop - start).count());
+            }
+            return minimum;
+        }
+
+        TuningChoice tune(const SOAMatrix & matrix, const size_t batch,
+                          const size_t repetitions) noexcept
+        {
+            const AVXVector input(matrix.columns(), 1.0F);
+            const vector<const AVXVector *> inputs(batch, &input);
+            AVXVector result(matrix.rows());
+
+            TuningChoice best{};
+            best.nanoseconds = numeric_limits<double>::max();
+            for (auto candidate : candidates(matrix.columns(), batch))
+            {
+                const TunedTransform tuned{matrix, candidate};
+                candidate.nanoseconds =
+                    batch > 1 ? measureMinimum(
+                                    repetitions,
+                                    [&]() { tuned.transform(inputs); })
+                              : measureMinimum(repetitions, [&]() {
+                                    tuned.transform(input, result);
+                                });
+                if (candidate.nanoseconds < best.nanoseconds)
+                {
+                    best = candidate;
+                }
+            }
+            return best;
+        }
+
+        // Whether a choice read from the tuning file can be planned.
+        bool isValid(const TuningChoice & choice) noexcept
+        {
+            if (isMultiThreaded(choice.kernel) && choice.threads == 0)
+            {
+                return false;
+            }
+            return !isPacked(choice.kernel) ||
+                   (choice.rowPanelPacks > 0 &&
+                    choice.rowPanelPacks <= PACKED_MAX_ROW_PANEL_PACKS &&
+                    choice.columnPanelColumns % NUM_FLOATS_PER_AVX_REGISTER ==
+                        0);
+        }
+
+        bool parseKernel(const string & name, Kernel & kernel) noexcept
+        {
+            for (const auto candidate : KERNELS)
+            {
+                if (name == kernelName(candidate))
+                {
+                    kernel = candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    const char * kernelName(const Kernel kernel) noexcept
+    {
+        switch (kernel)
+        {
+        case Kernel::TRANSFORM:
+            return "transform";
+        case Kernel::TRANSFORM_MULTI_THREADED:
+            return "transform-mt";
+        case Kernel::PACKED:
+            return "packed";
+        case Kernel::PACKED_MULTI_THREADED:
+            return "packed-mt";
+        case Kernel::BATCH:
+            return "batch";
+        }
+        return "unknown";
+    }
+
+    TunedTransform::TunedTransform(const SOAMatrix & matrix,
+                                   const TuningChoice & choice) noexcept
+        : _matrix{&matrix}, _choice{choice}
+    {
+        if (isPacked(choice.kernel))
+        {
+            this->_packed = make_unique<PackedMatrix>(
+                matrix, PackedBlocking{choice.rowPanelPacks,
+                                       choice.columnPanelColumns});
+        }
+
+        // The plan binds the count of threads, so that a call does not
+        // change the OpenMP default of the calling thread.
+        if (choice.kernel == Kernel::TRANSFORM_MULTI_THREADED)
+        {
+            PlanOptions options{};
+            options.threads = choice.threads;
+            this->_plan = make_unique<TransformPlan>(
+                matrix.rows(), matrix.columns(), options);
+        }
+    }
+
+    const TuningChoice & TunedTransform::choice() const noexcept
+    {
+        return this->_choice;
+    }
+
+    void TunedTransform::transform(const AVXVector & input,
+                                   AVXVector & result) const noexcept
+    {
+        switch (this->_choice.kernel)
+        {
+        case Kernel::TRANSFORM:
+        case Kernel::BATCH: {
+            TransformOptions options{};
+            options.prefetchDistance = this->_choice.prefetchDistance;
+            avx2::transform(*this->_matrix, input, options, result);
+            break;
+        }
+        case Kernel::TRANSFORM_MULTI_THREADED:
+            executeMultiThreaded(*this->_plan, *this->_matrix, input, result);
+            break;
+        case Kernel::PACKED:
+            transformPacked(*this->_packed, input, result);
+            break;
+        case Kernel::PACKED_MULTI_THREADED:
+            transformPackedMultiThreaded(*this->_packed, input, result,
+                                         this->_choice.threads);
+            break;
+        }
+    }
+
+    vector<AVXVector> TunedTransform::transform(
+        const vector<const AVXVector *> & inputs) const noexcept
+    {
+        if (this->_choice.kernel == Kernel::BATCH)
+        {
+            return transformBatch(*this->_matrix, inputs);
+        }
+
+        vector<AVXVector> results(inputs.size(),
+                                  AVXVector(this->_matrix->rows()));
+        for (size_t i{0}; i < inputs.size(); ++i)
+        {
+            this->transform(*inputs[i], results[i]);
+        }
+        return results;
+    }
+
+    Planner::Planner(const string & tuningFile,
+                     const size_t repetitions) noexcept
+        : _tuningFile{tuningFile}, _repetitions{repetitions}
+    {
+        assert(repetitions > 0);
+
+        ifstream file{tuningFile};
+        string line;
+        while (getline(file, line))
+        {
+            istringstream fields{line};
+            string model;
+            getline(fields, model, '\t');
+            if (model != host::cpuModel())
+            {
+                if (!line.empty())
+                {
+                    this->_foreignLines.push_back(line);
+                }
+                continue;
+            }
+
+            size_t rows{0};
+            size_t columns{0};
+            size_t batch{0};
+            string kernel;
+            TuningChoice choice{};
+            fields >> rows >> columns >> batch >> kernel >> choice.threads >>
+                choice.rowPanelPacks >> choice.columnPanelColumns >>
+                choice.prefetchDistance >> choice.nanoseconds;
+            if (fields && parseKernel(kernel, choice.kernel) &&
+                isValid(choice))
+            {
+                this->_choices[{rows, columns, batch}] = choice;
+            }
+        }
+    }
+
+    TunedTransform Planner::plan(const SOAMatrix & matrix,
+                                 const size_t batch) noexcept
+    {
+        return TunedTransform{matrix, this->choose(matrix, batch)};
+    }
+
+    const TuningChoice & Planner::choose(const SOAMatrix & matrix,
+                                         const size_t batch) noexcept
+    {
+        assert(batch > 0);
+
+        const Shape shape{matrix.rows(), matrix.columns(), batch};
+        const auto known = this->_choices.find(shape);
+        if (known != this->_choices.end())
+        {
+            return known->second;
+        }
+
+        const auto & choice = this->_choices[shape] =
+            tune(matrix, batch, this->_repetitions);
+        ++this->_tuningRuns;
+        this->save();
+        return choice;
+    }
+
+    size_t Planner::tuningRuns() const noexcept
+    {
+        return this->_tuningRuns;
+    }
+
+    void Planner::save() const noexcept
+    {
+        // Writes a temporary file first and renames it, so that concurrent
+        // processes never read a partially written tuning file.
+        const auto temporaryFile = this->_tuningFile + ".tmp";
+        {
+            ofstream file{temporaryFile, ios::trunc};
+            for (const auto & line : this->_foreignLines)
+            {
+                file << line << '\n';
+            }
+            for (const auto & [shape, choice] : this->_choices)
+            {
+                file << host::cpuModel() << '\t' << get<0>(shape) << '\t'
+                     << get<1>(shape) << '\t' << get<2>(shape) << '\t'
+                     << kernelName(choice.kernel) << '\t' << choice.threads
+                     << '\t' << choice.rowPanelPacks << '\t'
+                     << choice.columnPanelColumns << '\t'
+                     << choice.prefetchDistance << '\t' << choice.nanoseconds
+                     << '\n';
+            }
+            if (!file)
+            {
+                return;
+            }
+        }
+
+        error_code error;
+        filesystem::rename(temporaryFile, this->_tuningFile, error);
+    }
+
+    string defaultTuningFile() noexcept
+    {
+        const auto * variable = getenv("AVX2_TUNING_FILE");
+        return variable != nullptr && *variable != '\0' ? variable
+                                                        : "avx2-tuning.tsv";
+    }
+}
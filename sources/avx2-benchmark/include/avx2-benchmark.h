@@ -0,0 +1,115 @@
+#pragma once
+
+#include <benchmark-commons.h>
+#include <perf-counters.h>
+
+#include <vector>
+
+namespace matrixmultiplication::benchmark
+{
+    // Adds the hardware counters of a profiled run to the record, if they
+    // were available.
+    BenchmarkRecord & addCounters(BenchmarkRecord & record,
+                                  const profiling::PerfStats & stats) noexcept;
+
+    // Compares the scalar, the AVX2 and the multi-threaded AVX2 variant.
+    void runVariantsBenchmark(const BenchmarkArguments & arguments,
+                              std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Sweeps the prefetch distance of the transformation, so that it can be
+    // tuned per host.
+    void runPrefetchBenchmark(const BenchmarkArguments & arguments,
+                              std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Generates load from concurrent clients that transform their vectors
+    // by the same matrix, once directly and once through a coalescer, and
+    // reports the throughput and the latency percentiles of the requests.
+    void runCoalescingBenchmark(
+        const BenchmarkArguments & arguments,
+        std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Transforms many matrices of random row counts, each by its own vector,
+    // once per pair and once all pairs in arenas, single- and
+    // multi-threaded.
+    void runArenaBenchmark(const BenchmarkArguments & arguments,
+                           std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Plans each shape through the autotuning planner, which tunes it once
+    // per tuning file, and compares the tuned plan with the default single-
+    // and multi-threaded transformations.
+    void runAutotuneBenchmark(const BenchmarkArguments & arguments,
+                              std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the transformation of the fixed-size stack types against the
+    // dynamic path, for each of the supported square sizes.
+    void runFixedBenchmark(const BenchmarkArguments & arguments,
+                           std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the blocked matrix-matrix multiplication, single- and
+    // multi-threaded, with one transformation per column of B.
+    void runGemmBenchmark(const BenchmarkArguments & arguments,
+                          std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Times single transformations of small shapes on the general path, the
+    // dispatched transform and the small kernel with a preallocated result,
+    // and reports their latency percentiles and histograms.
+    void runLatencyBenchmark(const BenchmarkArguments & arguments,
+                             std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the level-1 vector operations single- and multi-threaded
+    // with scalar loops through the element accessors, and the fused update
+    // and norm with the separate passes.
+    void runBlas1Benchmark(const BenchmarkArguments & arguments,
+                           std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the transformation by a matrix repacked into kernel order
+    // with the one by the SOAMatrix, both relative to a STREAM-like read of
+    // the matrix, and reports the one-time cost of the repacking.
+    void runPackedBenchmark(const BenchmarkArguments & arguments,
+                            std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the execution of plans, single- and multi-threaded, with the
+    // free transformation functions for small and large shapes, and reports
+    // the one-time cost of planning.
+    void runPlanBenchmark(const BenchmarkArguments & arguments,
+                          std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the multi-threaded transformation split by row panels with
+    // the one split by columns, the latter with the fast and the
+    // reproducible addition of the partial results.
+    void runReductionBenchmark(const BenchmarkArguments & arguments,
+                               std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Runs the conjugate gradient, restarted GMRES and power iteration
+    // solvers with single- and multi-threaded products, and reports their
+    // convergence and time per iteration.
+    void runSolversBenchmark(const BenchmarkArguments & arguments,
+                             std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Compares the dense transformation with the sparse-input ones for
+    // inputs of increasing density. The gflops count the useful operations
+    // on the non-zero elements only.
+    void runSparseBenchmark(const BenchmarkArguments & arguments,
+                            std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Measures the multi-threaded transformations with the tracing of their
+    // phases disabled and enabled at runtime, and optionally writes the
+    // trace of the enabled runs as Chrome trace.
+    void runTracingBenchmark(const BenchmarkArguments & arguments,
+                             std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Measures the in-place matrix updates against the element-wise
+    // accessor path.
+    void runUpdatesBenchmark(const BenchmarkArguments & arguments,
+                             std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Runs the parallel kernels with 1 up to maxThreads threads, for a fixed
+    // total size (strong scaling) and a fixed size per thread (weak
+    // scaling), and reports the speedup and efficiency of each count. A lower
+    // triangular transformation, whose row panels differ in cost, compares
+    // the static split of the panels with the work-stealing scheduler.
+    void runScalingBenchmark(const BenchmarkArguments & arguments,
+                             std::vector<BenchmarkRecord> & records) noexcept;
+}
+
+int main(int argc, char * argv[]) noexcept;
@@ -0,0 +1,77 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-arena-transform.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <random>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runArenaBenchmark(const BenchmarkArguments & arguments,
+                           vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto count = arguments.get("matrices", size_t{4096});
+        const auto minRows = arguments.get("minRows", size_t{16});
+        const auto maxRows = arguments.get("maxRows", size_t{256});
+        const auto columns = arguments.get("columns", size_t{64});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        // Random but reproducible row counts, the same matrices once as
+        // separate objects and once in the arena.
+        mt19937 generator{42};
+        uniform_int_distribution<size_t> rowCount{minRows, maxRows};
+
+        vector<SOAMatrix> separateMatrices;
+        vector<AVXVector> separateInputs;
+        MatrixArena matrices;
+        VectorArena inputs;
+        double flops{0.0};
+        for (size_t m{0}; m < count; ++m)
+        {
+            const auto rows = rowCount(generator);
+            separateMatrices.push_back(randomMatrix(rows, columns));
+            separateInputs.push_back(randomVector(columns));
+            matrices.add(separateMatrices.back());
+            inputs.add(separateInputs.back());
+            flops += 2.0 * static_cast<double>(rows * columns);
+        }
+        const auto bytes = static_cast<double>(
+            (matrices.packs().size() + inputs.packs().size()) *
+            sizeof(AVXPack));
+
+        const auto record = [&](const char * variant, const Timing & timing) {
+            records.push_back(BenchmarkRecord{}
+                                  .add("benchmark", "arena")
+                                  .add("variant", variant)
+                                  .add("matrices", count)
+                                  .add("minRows", minRows)
+                                  .add("maxRows", maxRows)
+                                  .add("columns", columns)
+                                  .add(timing, flops, bytes));
+        };
+
+        // One transformation per pair, which allocates each result.
+        vector<AVXVector> separateResults;
+        separateResults.reserve(count);
+        record("transform-per-pair", measure(repetitions, [&]() {
+                   separateResults.clear();
+                   for (size_t m{0}; m < count; ++m)
+                   {
+                       separateResults.push_back(transform(
+                           separateMatrices[m], separateInputs[m]));
+                   }
+               }));
+
+        auto results = resultArena(matrices);
+        record("arena", measure(repetitions, [&]() {
+                   transformArena(matrices, inputs, results);
+               }));
+        record("arena-mt", measure(repetitions, [&]() {
+                   transformArenaMultiThreaded(matrices, inputs, results);
+               }));
+    }
+}
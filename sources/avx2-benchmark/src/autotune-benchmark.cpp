@@ -0,0 +1,97 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-autotune.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <chrono>
+
+using namespace std;
+using namespace matrixmultiplication::autotune;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runAutotuneBenchmark(const BenchmarkArguments & arguments,
+                              vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto shapes = parseShapes(
+            arguments.get("shapes", "64x65536,1024x1024,4096x4096"));
+        const auto batch = arguments.get("batch", size_t{1});
+        const auto repetitions = arguments.get("repetitions", size_t{20});
+        const auto tuningRepetitions =
+            arguments.get("tuningRepetitions", size_t{5});
+        const auto tuningFile =
+            arguments.get("tuningFile", defaultTuningFile().c_str());
+        Planner planner{tuningFile, tuningRepetitions};
+
+        for (const auto & shape : shapes)
+        {
+            const auto matrix = randomMatrix(shape.rows, shape.columns);
+            const auto inputVector = randomVector(shape.columns);
+            const vector<const AVXVector *> inputs(batch, &inputVector);
+            const auto flops = 2.0 * static_cast<double>(batch) *
+                               static_cast<double>(shape.rows) *
+                               static_cast<double>(shape.columns);
+            const auto bytes = matrixBytes(matrix);
+
+            // Planning tunes the shape only if the tuning file does not know
+            // it yet, which the record tells apart by tuningNanoseconds.
+            const auto tuningRuns = planner.tuningRuns();
+            const auto planStart = chrono::steady_clock::now();
+            const auto plan = planner.plan(matrix, batch);
+            const auto planNanoseconds =
+                chrono::duration<double, nano>(chrono::steady_clock::now() -
+                                               planStart)
+                    .count();
+            const auto tuned = planner.tuningRuns() > tuningRuns;
+            const auto & choice = plan.choice();
+
+            const auto record = [&](const char * variant,
+                                    const Timing & timing) {
+                records.push_back(
+                    BenchmarkRecord{}
+                        .add("benchmark", "autotune")
+                        .add("variant", variant)
+                        .add("rows", shape.rows)
+                        .add("columns", shape.columns)
+                        .add("batch", batch)
+                        .add("kernel", kernelName(choice.kernel))
+                        .add("threads", choice.threads)
+                        .add("rowPanelPacks", choice.rowPanelPacks)
+                        .add("columnPanelColumns", choice.columnPanelColumns)
+                        .add("prefetchDistance", choice.prefetchDistance)
+                        .add("tuningNanoseconds",
+                             tuned ? planNanoseconds : 0.0)
+                        .add(timing, flops, bytes));
+            };
+
+            // The defaults transform the batch vector by vector like the
+            // tuned plan does unless it chose the batch kernel.
+            vector<AVXVector> results(batch, AVXVector(shape.rows));
+            record("avx2", measure(repetitions, [&]() {
+                       for (size_t i{0}; i < batch; ++i)
+                       {
+                           transform(matrix, inputVector, results[i]);
+                       }
+                   }));
+            record("avx2-mt", measure(repetitions, [&]() {
+                       for (size_t i{0}; i < batch; ++i)
+                       {
+                           transformMultiThreaded(matrix, inputVector,
+                                                  results[i]);
+                       }
+                   }));
+            record("avx2-tuned", measure(repetitions, [&]() {
+                       if (batch == 1)
+                       {
+                           plan.transform(inputVector, results[0]);
+                       }
+                       else
+                       {
+                           results = plan.transform(inputs);
+                       }
+                   }));
+        }
+    }
+}
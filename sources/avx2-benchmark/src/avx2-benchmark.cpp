@@ -0,0 +1,141 @@
+#include "avx2-benchmark.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+using namespace matrixmultiplication::benchmark;
+
+namespace
+{
+    struct Benchmark
+    {
+        const char * name;
+        const char * usage;
+        void (*run)(const BenchmarkArguments &, vector<BenchmarkRecord> &);
+    };
+
+    const Benchmark BENCHMARKS[]{
+        {"variants", "rows=1000 columns=1000 repetitions=50",
+         runVariantsBenchmark},
+        {"prefetch",
+         "rows=64 columns=131072 repetitions=50 maxDistance=64 variant=avx2",
+         runPrefetchBenchmark},
+        {"scaling",
+         "rows=1000 columns=8192 rowsPerThread=1024 triangularSize=2048 "
+         "repetitions=50 maxThreads=<OMP_NUM_THREADS> variant=all",
+         runScalingBenchmark},
+        {"arena",
+         "matrices=4096 minRows=16 maxRows=256 columns=64 repetitions=50",
+         runArenaBenchmark},
+        {"autotune",
+         "shapes=64x65536,1024x1024,4096x4096 batch=1 repetitions=20 "
+         "tuningRepetitions=5 tuningFile=<AVX2_TUNING_FILE>",
+         runAutotuneBenchmark},
+        {"blas1", "size=1048576 repetitions=50", runBlas1Benchmark},
+        {"fixed", "calls=10000 repetitions=50", runFixedBenchmark},
+        {"gemm", "rows=512 inner=512 columns=512 repetitions=10",
+         runGemmBenchmark},
+        {"latency", "shapes=4x4,8x8,16x16,32x32,63x63,64x256 samples=100000",
+         runLatencyBenchmark},
+        {"packed",
+         "rows=4096 columns=4096 rowPanelPacks=8 columnPanelColumns=0 "
+         "repetitions=20",
+         runPackedBenchmark},
+        {"plan",
+         "shapes=8x8,16x16,32x32,64x64,256x256,1024x1024,4096x4096 "
+         "repetitions=50 flopsPerRepetition=4194304",
+         runPlanBenchmark},
+        {"reduction", "shapes=64x262144,1024x16384 repetitions=50",
+         runReductionBenchmark},
+        {"solvers",
+         "size=2048 condition=100 restart=30 maxIterations=1000 "
+         "repetitions=10",
+         runSolversBenchmark},
+        {"sparse", "rows=256 columns=16384 repetitions=50", runSparseBenchmark},
+        {"tracing", "shapes=64x65536,1024x4096 repetitions=50 traceFile=",
+         runTracingBenchmark},
+        {"updates",
+         "rows=4096 columns=4096 repetitions=20 accessorRepetitions=2",
+         runUpdatesBenchmark},
+        {"coalescing",
+         "rows=1024 columns=1024 clients=8 requests=200 maxBatch=16 "
+         "maxDelayMicroseconds=100",
+         runCoalescingBenchmark},
+    };
+
+    void printUsage() noexcept
+    {
+        cerr << "usage: avx2-benchmark <benchmark> [format=json|csv]"
+                " [key=value ...]"
+             << endl;
+        for (auto && benchmark : BENCHMARKS)
+        {
+            cerr << "  " << benchmark.name << " " << benchmark.usage << endl;
+        }
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    BenchmarkRecord & addCounters(BenchmarkRecord & record,
+                                  const profiling::PerfStats & stats) noexcept
+    {
+        record.add("countersAvailable", size_t{stats.available});
+        if (!stats.available)
+        {
+            return record;
+        }
+
+        // Multiplexed counts are extrapolated from the fraction of the time
+        // the counters ran.
+        const auto cycles = static_cast<double>(stats.cycles);
+        return record
+            .add("countersMultiplexed", size_t{profiling::isMultiplexed(stats)})
+            .add("countersRunningFraction",
+                 static_cast<double>(stats.timeRunning) /
+                     static_cast<double>(stats.timeEnabled))
+            .add("cycles", static_cast<size_t>(stats.cycles))
+            .add("instructions", static_cast<size_t>(stats.instructions))
+            .add("instructionsPerCycle",
+                 cycles > 0.0 ? static_cast<double>(stats.instructions) / cycles
+                              : 0.0)
+            .add("llcMisses", static_cast<size_t>(stats.llcMisses))
+            .add("dtlbMisses", static_cast<size_t>(stats.dtlbMisses))
+            .add("bytesMoved", stats.bytesMoved)
+            .add("bytesPerCycle",
+                 cycles > 0.0 ? stats.bytesMoved / cycles : 0.0);
+    }
+}
+
+int main(int argc, char * argv[]) noexcept
+{
+    if (argc < 2)
+    {
+        printUsage();
+        return 1;
+    }
+
+    for (auto && benchmark : BENCHMARKS)
+    {
+        if (strcmp(argv[1], benchmark.name) == 0)
+        {
+            const BenchmarkArguments arguments{argc, argv, 2};
+
+            vector<BenchmarkRecord> records;
+            benchmark.run(arguments, records);
+            if (arguments.get("format", "json") == "csv")
+            {
+                writeRecordsAsCsv(cout, records);
+            }
+            else
+            {
+                writeRecords(cout, records);
+            }
+            return 0;
+        }
+    }
+
+    printUsage();
+    return 1;
+}
@@ -0,0 +1,104 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-blas1-mt.h>
+#include <avx2-blas1.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace
+{
+    // The scalar loops through the element accessors, which the level-1
+    // operations replace.
+    float scalarDot(const AVXVector & x, const AVXVector & y) noexcept
+    {
+        auto sum = 0.0F;
+        for (size_t i{0}; i < x.size(); ++i)
+        {
+            sum += x.at(i) * y.at(i);
+        }
+        return sum;
+    }
+
+    void scalarAxpby(const float alpha, const AVXVector & x, const float beta,
+                     AVXVector & y) noexcept
+    {
+        for (size_t i{0}; i < x.size(); ++i)
+        {
+            y.at(i) = alpha * x.at(i) + beta * y.at(i);
+        }
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runBlas1Benchmark(const BenchmarkArguments & arguments,
+                           vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto size = arguments.get("size", size_t{1} << 20);
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        const auto x = randomVector(size);
+        auto y = randomVector(size);
+        const auto vectorBytes =
+            static_cast<double>(x.packs().size() * sizeof(AVXPack));
+        const auto elements = static_cast<double>(size);
+
+        // Keeps the reductions from being optimized away.
+        volatile float sink{0.0F};
+
+        // The factors keep y bounded over the repetitions.
+        constexpr auto alpha = 0.5F;
+        constexpr auto beta = 0.5F;
+
+        const auto record = [&](const char * operation, const char * variant,
+                                const Timing & timing, const double flops,
+                                const double vectorsMoved) {
+            records.push_back(BenchmarkRecord{}
+                                  .add("benchmark", "blas1")
+                                  .add("operation", operation)
+                                  .add("variant", variant)
+                                  .add("size", size)
+                                  .add(timing, flops * elements,
+                                       vectorsMoved * vectorBytes));
+        };
+
+        // x . y reads two vectors.
+        record("dot", "scalar",
+               measure(repetitions, [&]() { sink = scalarDot(x, y); }), 2.0,
+               2.0);
+        record("dot", "avx2",
+               measure(repetitions, [&]() { sink = dot(x, y); }), 2.0, 2.0);
+        record("dot", "avx2-mt",
+               measure(repetitions, [&]() { sink = dotMultiThreaded(x, y); }),
+               2.0, 2.0);
+
+        // y = alpha * x + beta * y reads two vectors and writes one.
+        record("axpby", "scalar", measure(repetitions, [&]() {
+                   scalarAxpby(alpha, x, beta, y);
+               }),
+               3.0, 3.0);
+        record("axpby", "avx2",
+               measure(repetitions, [&]() { axpby(alpha, x, beta, y); }), 3.0,
+               3.0);
+        record("axpby", "avx2-mt", measure(repetitions, [&]() {
+                   axpbyMultiThreaded(alpha, x, beta, y);
+               }),
+               3.0, 3.0);
+
+        // The update followed by the norm reads y once more unless fused.
+        record("axpby+squaredNorm", "avx2", measure(repetitions, [&]() {
+                   axpby(alpha, x, beta, y);
+                   sink = squaredNorm(y);
+               }),
+               5.0, 4.0);
+        record("axpbyAndSquaredNorm", "avx2", measure(repetitions, [&]() {
+                   sink = axpbyAndSquaredNorm(alpha, x, beta, y);
+               }),
+               5.0, 3.0);
+        record("axpbyAndSquaredNorm", "avx2-mt", measure(repetitions, [&]() {
+                   sink = axpbyAndSquaredNormMultiThreaded(alpha, x, beta, y);
+               }),
+               5.0, 3.0);
+    }
+}
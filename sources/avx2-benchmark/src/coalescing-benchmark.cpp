@@ -0,0 +1,138 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-coalescer.h>
+#include <avx2-variant.h>
+
+#include <thread>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    namespace
+    {
+        // Runs closed-loop clients, each issuing its requests one after the
+        // other, and returns the latencies of all requests. The wall clock
+        // time of the whole load is added to totalNanoseconds.
+        template <typename Request>
+        vector<double> generateLoad(const size_t clients,
+                                    const size_t requestsPerClient,
+                                    const size_t columns, Request && request,
+                                    double & totalNanoseconds) noexcept
+        {
+            vector<vector<double>> latencies(clients);
+            vector<thread> threads;
+
+            const auto start = chrono::steady_clock::now();
+            for (size_t client{0}; client < clients; ++client)
+            {
+                threads.emplace_back([&, client]() {
+                    const auto inputVector = randomVector(columns);
+                    auto & clientLatencies = latencies[client];
+                    clientLatencies.reserve(requestsPerClient);
+
+                    for (size_t i{0}; i < requestsPerClient; ++i)
+                    {
+                        const auto requestStart = chrono::steady_clock::now();
+                        request(inputVector);
+                        const auto requestEnd = chrono::steady_clock::now();
+                        clientLatencies.push_back(
+                            chrono::duration<double, nano>(requestEnd -
+                                                           requestStart)
+                                .count());
+                    }
+                });
+            }
+            for (auto && thread : threads)
+            {
+                thread.join();
+            }
+            const auto end = chrono::steady_clock::now();
+            totalNanoseconds =
+                chrono::duration<double, nano>(end - start).count();
+
+            vector<double> allLatencies;
+            for (auto && clientLatencies : latencies)
+            {
+                allLatencies.insert(allLatencies.end(),
+                                    clientLatencies.begin(),
+                                    clientLatencies.end());
+            }
+            return allLatencies;
+        }
+    }
+
+    void runCoalescingBenchmark(const BenchmarkArguments & arguments,
+                                vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{1024});
+        const auto columns = arguments.get("columns", size_t{1024});
+        const auto clients = arguments.get("clients", size_t{8});
+        const auto requestsPerClient = arguments.get("requests", size_t{200});
+
+        CoalescingWindow window{};
+        window.maxBatch = arguments.get("maxBatch", window.maxBatch);
+        window.maxDelay = chrono::microseconds(arguments.get(
+            "maxDelayMicroseconds",
+            static_cast<size_t>(window.maxDelay.count())));
+
+        const auto matrix = randomMatrix(rows, columns);
+
+        const auto record = [&](const char * mode,
+                                vector<double> latencies,
+                                const double totalNanoseconds) {
+            const auto timing = summarize(move(latencies));
+            return BenchmarkRecord{}
+                .add("benchmark", "coalescing")
+                .add("mode", mode)
+                .add("rows", rows)
+                .add("columns", columns)
+                .add("clients", clients)
+                .add("requests", timing.repetitions)
+                .add("requestsPerSecond",
+                     1e9 * static_cast<double>(timing.repetitions) /
+                         totalNanoseconds)
+                .add("minimumNanoseconds", timing.minimumNanoseconds)
+                .add("medianNanoseconds", timing.medianNanoseconds)
+                .add("p99Nanoseconds", timing.p99Nanoseconds);
+        };
+
+        {
+            auto totalNanoseconds = 0.0;
+            auto latencies = generateLoad(
+                clients, requestsPerClient, columns,
+                [&](const AVXVector & inputVector) {
+                    return transform(matrix, inputVector);
+                },
+                totalNanoseconds);
+            records.push_back(
+                record("direct", move(latencies), totalNanoseconds));
+        }
+
+        {
+            TransformCoalescer coalescer{matrix, window};
+
+            auto totalNanoseconds = 0.0;
+            auto latencies = generateLoad(
+                clients, requestsPerClient, columns,
+                [&](const AVXVector & inputVector) {
+                    return coalescer.transform(inputVector);
+                },
+                totalNanoseconds);
+
+            const auto stats = coalescer.stats();
+            auto coalescedRecord =
+                record("coalesced", move(latencies), totalNanoseconds);
+            coalescedRecord.add("maxBatch", window.maxBatch)
+                .add("maxDelayMicroseconds",
+                     static_cast<size_t>(window.maxDelay.count()))
+                .add("meanBatchSize",
+                     stats.batches > 0
+                         ? static_cast<double>(stats.requests) /
+                               static_cast<double>(stats.batches)
+                         : 0.0);
+            records.push_back(coalescedRecord);
+        }
+    }
+}
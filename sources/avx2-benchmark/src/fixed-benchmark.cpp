@@ -0,0 +1,131 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-fixed-variant.h>
+#include <avx2-variant.h>
+
+#include <array>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace
+{
+    using namespace matrixmultiplication::benchmark;
+
+    // Count of input vectors the calls cycle through.
+    constexpr size_t INPUTS{8};
+
+    // Offset of the input index, which is read anew on every call, so that
+    // the compiler cannot hoist the transformations of the invariant inputs
+    // out of the measured loop.
+    volatile size_t inputOffset{0};
+
+    // Adds the packs of the result to the sink, which keeps every result
+    // pack alive at the cost of one add per pack.
+    template <typename Packs, typename SinkPacks>
+    void accumulate(const Packs & packs, SinkPacks & sinkPacks) noexcept
+    {
+        for (size_t p{0}; p < sinkPacks.size(); ++p)
+        {
+            _mm256_store_ps(sinkPacks[p].data(),
+                            _mm256_add_ps(_mm256_load_ps(sinkPacks[p].data()),
+                                          _mm256_load_ps(packs[p].data())));
+        }
+    }
+
+    template <size_t N>
+    void runFixedSize(const size_t calls, const size_t repetitions,
+                      vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto matrix = randomMatrix(N, N);
+        vector<AVXVector> inputVectors;
+        for (size_t i{0}; i < INPUTS; ++i)
+        {
+            inputVectors.push_back(randomVector(N));
+        }
+
+        FixedMatrix<N, N> fixedMatrix;
+        for (size_t c{0}; c < N; ++c)
+        {
+            for (size_t r{0}; r < N; ++r)
+            {
+                fixedMatrix.at(r, c) = matrix.at(r, c);
+            }
+        }
+        array<FixedVector<N>, INPUTS> fixedInputVectors;
+        for (size_t i{0}; i < INPUTS; ++i)
+        {
+            for (size_t j{0}; j < N; ++j)
+            {
+                fixedInputVectors[i].at(j) = inputVectors[i].at(j);
+            }
+        }
+
+        FixedVector<N> sink;
+        const auto dynamicTiming = measure(repetitions, [&]() {
+            for (size_t i{0}; i < calls; ++i)
+            {
+                const auto result =
+                    transform(matrix, inputVectors[(i + inputOffset) % INPUTS]);
+                accumulate(result.packs(), sink.packs());
+            }
+        });
+        const auto fixedTiming = measure(repetitions, [&]() {
+            for (size_t i{0}; i < calls; ++i)
+            {
+                const auto result = transform(
+                    fixedMatrix, fixedInputVectors[(i + inputOffset) % INPUTS]);
+                accumulate(result.packs(), sink.packs());
+            }
+        });
+
+        // Reading the sink once keeps the measured loops from being
+        // eliminated.
+        volatile auto sinkValue = sink.at(0);
+        static_cast<void>(sinkValue);
+
+        const auto flops = 2.0 * static_cast<double>(N * N * calls);
+        const auto bytes = static_cast<double>(
+            (matrix.packs().size() + inputVectors[0].packs().size() +
+             FixedVector<N>::PACKS) *
+            sizeof(AVXPack) * calls);
+
+        const auto record = [&](const char * variant, const Timing & timing) {
+            records.push_back(
+                BenchmarkRecord{}
+                    .add("benchmark", "fixed")
+                    .add("variant", variant)
+                    .add("rows", N)
+                    .add("columns", N)
+                    .add("callsPerRun", calls)
+                    .add(timing, flops, bytes)
+                    .add("nanosecondsPerCall", timing.medianNanoseconds /
+                                                   static_cast<double>(calls)));
+        };
+
+        record("dynamic", dynamicTiming);
+        record("fixed", fixedTiming);
+        if (fixedTiming.medianNanoseconds > 0.0)
+        {
+            records.back().add("speedup", dynamicTiming.medianNanoseconds /
+                                              fixedTiming.medianNanoseconds);
+        }
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runFixedBenchmark(const BenchmarkArguments & arguments,
+                           vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto calls = arguments.get("calls", size_t{10000});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        // The fixed shapes are template arguments, so the benchmarked sizes
+        // are fixed at compile time as well.
+        runFixedSize<4>(calls, repetitions, records);
+        runFixedSize<8>(calls, repetitions, records);
+        runFixedSize<16>(calls, repetitions, records);
+        runFixedSize<32>(calls, repetitions, records);
+    }
+}
@@ -0,0 +1,64 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-gemm.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runGemmBenchmark(const BenchmarkArguments & arguments,
+                          vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{512});
+        const auto inner = arguments.get("inner", size_t{512});
+        const auto columns = arguments.get("columns", size_t{512});
+        const auto repetitions = arguments.get("repetitions", size_t{10});
+
+        const auto a = randomMatrix(rows, inner);
+        const auto b = randomMatrix(inner, columns);
+        const auto flops = 2.0 * static_cast<double>(rows * inner * columns);
+
+        // The minimal traffic reads A and B and writes C once.
+        const auto bytes = matrixBytes(a) + matrixBytes(b) +
+                           static_cast<double>(padSize(rows) * columns *
+                                               sizeof(AVXPack));
+
+        const auto record = [&](const char * variant, const Timing & timing) {
+            records.push_back(BenchmarkRecord{}
+                                  .add("benchmark", "gemm")
+                                  .add("variant", variant)
+                                  .add("rows", rows)
+                                  .add("inner", inner)
+                                  .add("columns", columns)
+                                  .add(timing, flops, bytes));
+        };
+
+        // The route before the GEMM, which streams A once per column of B.
+        const auto packsPerColumn = padSize(inner);
+        SOAMatrix result{rows, columns};
+        record("transform-per-column", measure(repetitions, [&]() {
+                   AVXVector column(inner);
+                   for (size_t c{0}; c < columns; ++c)
+                   {
+                       copy_n(b.packs().cbegin() +
+                                  static_cast<int64_t>(c * packsPerColumn),
+                              packsPerColumn, column.packs().begin());
+                       const auto product = transform(a, column);
+                       copy(product.packs().cbegin(), product.packs().cend(),
+                            result.packs().begin() +
+                                static_cast<int64_t>(c * padSize(rows)));
+                   }
+               }));
+
+        record("multiply",
+               measure(repetitions, [&]() { result = multiply(a, b); }));
+        record("multiply-mt", measure(repetitions, [&]() {
+                   result = multiplyMultiThreaded(a, b);
+               }));
+    }
+}
@@ -0,0 +1,163 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-small.h>
+#include <avx2-variant.h>
+
+#include <iostream>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace
+{
+    using namespace matrixmultiplication::benchmark;
+
+    // Upper bound of the first histogram bucket. Each further bucket doubles
+    // the bound, and the last one takes all slower calls.
+    constexpr double FIRST_BUCKET_NANOSECONDS{16.0};
+    constexpr size_t BUCKETS{14};
+
+    // Receives one element of each result, so that no call is optimized
+    // away.
+    volatile float resultSink{0.0F};
+
+    // Times each call on its own, after one warm-up call.
+    template <typename Function>
+    vector<double> sampleLatencies(const size_t samples,
+                                   Function && function) noexcept
+    {
+        function();
+
+        vector<double> nanoseconds;
+        nanoseconds.reserve(samples);
+        for (size_t i{0}; i < samples; ++i)
+        {
+            const auto start = chrono::steady_clock::now();
+            function();
+            const auto end = chrono::steady_clock::now();
+
+            nanoseconds.push_back(
+                chrono::duration<double, nano>(end - start).count());
+        }
+        return nanoseconds;
+    }
+
+    void addLatencyRecords(const char * variant, const Shape & shape,
+                           const double clockOverhead,
+                           vector<double> nanoseconds,
+                           vector<BenchmarkRecord> & records) noexcept
+    {
+        size_t counts[BUCKETS]{};
+        for (auto sample : nanoseconds)
+        {
+            auto bound = FIRST_BUCKET_NANOSECONDS;
+            size_t bucket{0};
+            while (bucket + 1 < BUCKETS && sample >= bound)
+            {
+                bound *= 2.0;
+                ++bucket;
+            }
+            ++counts[bucket];
+        }
+
+        sort(nanoseconds.begin(), nanoseconds.end());
+        const auto count = nanoseconds.size();
+        const auto percentile = [&](const size_t perMille) {
+            return nanoseconds[min(count - 1, count * perMille / 1000)];
+        };
+
+        records.push_back(BenchmarkRecord{}
+                              .add("benchmark", "latency")
+                              .add("kind", "summary")
+                              .add("variant", variant)
+                              .add("rows", shape.rows)
+                              .add("columns", shape.columns)
+                              .add("samples", count)
+                              .add("clockOverheadNanoseconds", clockOverhead)
+                              .add("minimumNanoseconds", nanoseconds.front())
+                              .add("p50Nanoseconds", percentile(500))
+                              .add("p90Nanoseconds", percentile(900))
+                              .add("p99Nanoseconds", percentile(990))
+                              .add("p999Nanoseconds", percentile(999)));
+
+        auto bound = FIRST_BUCKET_NANOSECONDS;
+        for (size_t bucket{0}; bucket < BUCKETS; ++bucket)
+        {
+            BenchmarkRecord record;
+            record.add("benchmark", "latency")
+                .add("kind", "histogram")
+                .add("variant", variant)
+                .add("rows", shape.rows)
+                .add("columns", shape.columns);
+            if (bucket + 1 < BUCKETS)
+            {
+                record.add("upperNanoseconds", bound);
+            }
+            records.push_back(record.add("count", counts[bucket]));
+            bound *= 2.0;
+        }
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runLatencyBenchmark(const BenchmarkArguments & arguments,
+                             vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto shapes = parseShapes(
+            arguments.get("shapes", "4x4,8x8,16x16,32x32,63x63,64x256"));
+        const auto samples = arguments.get("samples", size_t{100000});
+        if (samples == 0)
+        {
+            cerr << "latency: samples must be positive" << endl;
+            return;
+        }
+
+        // The latencies include the cost of reading the clock, which is
+        // reported along with them.
+        auto overheads = sampleLatencies(samples, []() {});
+        sort(overheads.begin(), overheads.end());
+        const auto clockOverhead = overheads[overheads.size() / 2];
+
+        for (auto && shape : shapes)
+        {
+            const auto matrix = randomMatrix(shape.rows, shape.columns);
+            const auto inputVector = randomVector(shape.columns);
+
+            // The general path, which the small shapes took before.
+            addLatencyRecords(
+                "general", shape, clockOverhead,
+                sampleLatencies(samples,
+                                [&]() {
+                                    const auto result = transform(
+                                        matrix, inputVector,
+                                        TransformOptions{});
+                                    resultSink = result.at(0);
+                                }),
+                records);
+
+            addLatencyRecords("dispatched", shape, clockOverhead,
+                              sampleLatencies(samples,
+                                              [&]() {
+                                                  const auto result = transform(
+                                                      matrix, inputVector);
+                                                  resultSink = result.at(0);
+                                              }),
+                              records);
+
+            if (isSmallShape(matrix))
+            {
+                AVXVector result(shape.rows);
+                addLatencyRecords(
+                    "small-preallocated", shape, clockOverhead,
+                    sampleLatencies(samples,
+                                    [&]() {
+                                        transformSmall(matrix, inputVector,
+                                                       result);
+                                        resultSink = result.at(0);
+                                    }),
+                    records);
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-packed.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <chrono>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace
+{
+    // Reads the packs once like a STREAM sum, which bounds the bandwidth a
+    // transformation reading the same packs can reach.
+    float streamRead(const vector<AVXPack> & packs) noexcept
+    {
+        __m256 sums[]{_mm256_setzero_ps(), _mm256_setzero_ps(),
+                      _mm256_setzero_ps(), _mm256_setzero_ps()};
+        size_t p{0};
+        for (; p + 4 <= packs.size(); p += 4)
+        {
+            for (size_t i{0}; i < 4; ++i)
+            {
+                sums[i] =
+                    _mm256_add_ps(_mm256_load_ps(packs[p + i].data()), sums[i]);
+            }
+        }
+        for (; p < packs.size(); ++p)
+        {
+            sums[0] = _mm256_add_ps(_mm256_load_ps(packs[p].data()), sums[0]);
+        }
+        const auto sum = _mm256_add_ps(_mm256_add_ps(sums[0], sums[1]),
+                                       _mm256_add_ps(sums[2], sums[3]));
+        return _mm256_cvtss_f32(sum);
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runPackedBenchmark(const BenchmarkArguments & arguments,
+                            vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{4096});
+        const auto columns = arguments.get("columns", size_t{4096});
+        const auto repetitions = arguments.get("repetitions", size_t{20});
+        PackedBlocking blocking{};
+        blocking.rowPanelPacks =
+            arguments.get("rowPanelPacks", blocking.rowPanelPacks);
+        blocking.columnPanelColumns =
+            arguments.get("columnPanelColumns", blocking.columnPanelColumns);
+
+        const auto matrix = randomMatrix(rows, columns);
+        const auto inputVector = randomVector(columns);
+        const auto flops =
+            2.0 * static_cast<double>(rows) * static_cast<double>(columns);
+        const auto bytes = matrixBytes(matrix);
+
+        // The repacking is paid once, so it is timed once.
+        const auto repackStart = chrono::steady_clock::now();
+        const PackedMatrix packed{matrix, blocking};
+        const auto repackNanoseconds =
+            chrono::duration<double, nano>(chrono::steady_clock::now() -
+                                           repackStart)
+                .count();
+
+        volatile float sink{0.0F};
+        const auto streamTiming = measure(
+            repetitions, [&]() { sink = streamRead(packed.packs()); });
+        const auto streamGigabytesPerSecond =
+            bytes / streamTiming.medianNanoseconds;
+
+        const auto record = [&](const char * variant, const Timing & timing) {
+            records.push_back(
+                BenchmarkRecord{}
+                    .add("benchmark", "packed")
+                    .add("variant", variant)
+                    .add("rows", rows)
+                    .add("columns", columns)
+                    .add("rowPanelPacks", packed.blocking().rowPanelPacks)
+                    .add("columnPanelColumns",
+                         packed.blocking().columnPanelColumns)
+                    .add("repackNanoseconds", repackNanoseconds)
+                    .add(timing, flops, bytes)
+                    .add("fractionOfStreamRead",
+                         bytes / timing.medianNanoseconds /
+                             streamGigabytesPerSecond));
+        };
+
+        record("stream-read", streamTiming);
+
+        AVXVector result(rows);
+        record("avx2", measure(repetitions, [&]() {
+                   transform(matrix, inputVector, result);
+               }));
+        record("avx2-packed", measure(repetitions, [&]() {
+                   transformPacked(packed, inputVector, result);
+               }));
+        record("avx2-mt", measure(repetitions, [&]() {
+                   transformMultiThreaded(matrix, inputVector, result);
+               }));
+        record("avx2-mt-packed", measure(repetitions, [&]() {
+                   transformPackedMultiThreaded(packed, inputVector, result);
+               }));
+    }
+}
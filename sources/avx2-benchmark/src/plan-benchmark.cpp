@@ -0,0 +1,93 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-plan.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runPlanBenchmark(const BenchmarkArguments & arguments,
+                          vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto shapes = parseShapes(arguments.get(
+            "shapes", "8x8,16x16,32x32,64x64,256x256,1024x1024,4096x4096"));
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        // Each repetition runs as many calls as take about this many
+        // flops, so that small shapes are not dominated by the clock.
+        const auto flopsPerRepetition =
+            arguments.get("flopsPerRepetition", size_t{1} << 22);
+
+        for (const auto & shape : shapes)
+        {
+            const auto matrix = randomMatrix(shape.rows, shape.columns);
+            const auto inputVector = randomVector(shape.columns);
+            const auto flopsPerCall = 2 * shape.rows * shape.columns;
+            const auto calls =
+                max(size_t{1}, flopsPerRepetition / flopsPerCall);
+            const auto flops = static_cast<double>(flopsPerCall * calls);
+            const auto bytes = matrixBytes(matrix) * static_cast<double>(calls);
+
+            // Planning is paid once per shape, so it is timed once.
+            const auto planStart = chrono::steady_clock::now();
+            const TransformPlan plan{shape.rows, shape.columns};
+            const auto planNanoseconds =
+                chrono::duration<double, nano>(chrono::steady_clock::now() -
+                                               planStart)
+                    .count();
+
+            PlanOptions multiThreadedOptions{};
+            multiThreadedOptions.threads =
+                static_cast<size_t>(omp_get_max_threads());
+            const TransformPlan multiThreadedPlan{
+                shape.rows, shape.columns, multiThreadedOptions};
+
+            const auto record = [&](const char * variant,
+                                    const Timing & timing) {
+                records.push_back(
+                    BenchmarkRecord{}
+                        .add("benchmark", "plan")
+                        .add("variant", variant)
+                        .add("rows", shape.rows)
+                        .add("columns", shape.columns)
+                        .add("callsPerRepetition", calls)
+                        .add("nanosecondsPerCall",
+                             timing.medianNanoseconds /
+                                 static_cast<double>(calls))
+                        .add("planNanoseconds", planNanoseconds)
+                        .add(timing, flops, bytes));
+            };
+
+            AVXVector result(shape.rows);
+            const auto callsOf = [&](auto && call) {
+                return measure(repetitions, [&]() {
+                    for (size_t i{0}; i < calls; ++i)
+                    {
+                        call();
+                    }
+                });
+            };
+            record("avx2", callsOf([&]() {
+                       transform(matrix, inputVector, result);
+                   }));
+            record("avx2-plan", callsOf([&]() {
+                       plan.execute(matrix, inputVector, result);
+                   }));
+            record("avx2-mt", callsOf([&]() {
+                       transformMultiThreaded(matrix, inputVector, result);
+                   }));
+            record("avx2-mt-plan", callsOf([&]() {
+                       executeMultiThreaded(multiThreadedPlan, matrix,
+                                            inputVector, result);
+                   }));
+        }
+    }
+}
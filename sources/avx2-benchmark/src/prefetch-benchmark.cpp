@@ -0,0 +1,61 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runPrefetchBenchmark(const BenchmarkArguments & arguments,
+                              vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{64});
+        const auto columns = arguments.get("columns", size_t{131072});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+        const auto maxDistance = arguments.get("maxDistance", size_t{64});
+        const auto variant = arguments.get("variant", "avx2");
+        const auto multiThreaded = variant == "avx2-mt";
+
+        const auto matrix = randomMatrix(rows, columns);
+        const auto inputVector = randomVector(columns);
+        const auto flops = 2.0 * static_cast<double>(rows * columns);
+
+        // Zero disables the software prefetching, then the distances double.
+        for (size_t distance{0}; distance <= maxDistance;
+             distance = distance == 0 ? 1 : distance * 2)
+        {
+            TransformOptions options{};
+            options.prefetchDistance = distance;
+
+            AVXVector result(rows);
+            const auto timing = measure(repetitions, [&]() {
+                result = multiThreaded
+                             ? transformMultiThreaded(matrix, inputVector,
+                                                      options)
+                             : transform(matrix, inputVector, options);
+            });
+
+            const auto before = multiThreaded ? profiling::readTeamCounters()
+                                              : profiling::readThreadCounters();
+            result = multiThreaded
+                         ? transformMultiThreaded(matrix, inputVector, options)
+                         : transform(matrix, inputVector, options);
+            auto stats = (multiThreaded ? profiling::readTeamCounters()
+                                        : profiling::readThreadCounters()) -
+                         before;
+            stats.bytesMoved = matrixBytes(matrix);
+
+            auto record = BenchmarkRecord{}
+                              .add("benchmark", "prefetch")
+                              .add("variant", variant)
+                              .add("rows", rows)
+                              .add("columns", columns)
+                              .add("prefetchDistance", distance)
+                              .add(timing, flops, matrixBytes(matrix))
+                              .add("checksum", double{result.at(0)});
+            records.push_back(addCounters(record, stats));
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <omp.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runReductionBenchmark(const BenchmarkArguments & arguments,
+                               vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto shapes = parseShapes(
+            arguments.get("shapes", "64x262144,1024x16384"));
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        TransformOptions fast{};
+        TransformOptions reproducible{};
+        reproducible.reductionMode = ReductionMode::REPRODUCIBLE;
+
+        for (const auto & shape : shapes)
+        {
+            const auto matrix = randomMatrix(shape.rows, shape.columns);
+            const auto inputVector = randomVector(shape.columns);
+            const auto flops = 2.0 * static_cast<double>(shape.rows) *
+                               static_cast<double>(shape.columns);
+            const auto bytes = matrixBytes(matrix);
+
+            const auto record = [&](const char * variant,
+                                    const Timing & timing) {
+                records.push_back(
+                    BenchmarkRecord{}
+                        .add("benchmark", "reduction")
+                        .add("variant", variant)
+                        .add("rows", shape.rows)
+                        .add("columns", shape.columns)
+                        .add("threads",
+                             static_cast<size_t>(omp_get_max_threads()))
+                        .add(timing, flops, bytes));
+            };
+
+            AVXVector result(shape.rows);
+            record("avx2", measure(repetitions, [&]() {
+                       transform(matrix, inputVector, result);
+                   }));
+            record("avx2-mt-row-panels", measure(repetitions, [&]() {
+                       transformMultiThreaded(matrix, inputVector, result);
+                   }));
+            record("avx2-mt-split-columns-fast", measure(repetitions, [&]() {
+                       transformSplitColumnsMultiThreaded(matrix, inputVector,
+                                                          fast, result);
+                   }));
+            record("avx2-mt-split-columns-reproducible",
+                   measure(repetitions, [&]() {
+                       transformSplitColumnsMultiThreaded(
+                           matrix, inputVector, reproducible, result);
+                   }));
+        }
+    }
+}
@@ -0,0 +1,575 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-arena.h>
+#include <avx2-blas1-mt.h>
+#include <avx2-packed-model.h>
+#include <avx2-plan.h>
+#include <avx2-variant-mt.h>
+#include <work-stealing.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <omp.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    namespace
+    {
+        // A kernel with its operands, which returns a checksum of its result
+        // per call, along with the work of a call.
+        struct PreparedKernel
+        {
+            function<float()> run;
+            double flops;
+            double bytes;
+        };
+
+        struct ParallelKernel
+        {
+            const char * name;
+
+            // Derives the operands of the kernel from the matrix and the
+            // input vector of the harness, and prepares them once before the
+            // calls are measured, e.g. by repacking the matrix. The matrix
+            // and the input vector outlive the prepared kernel.
+            PreparedKernel (*prepare)(const SOAMatrix &, const AVXVector &);
+        };
+
+        // A transformation by the matrix into a result of its rows.
+        PreparedKernel preparedTransform(
+            const SOAMatrix & matrix,
+            function<void(AVXVector &)> transform) noexcept
+        {
+            const auto result = make_shared<AVXVector>(matrix.rows());
+            return {[result, transform]() {
+                        transform(*result);
+                        return result->at(0);
+                    },
+                    2.0 * static_cast<double>(matrix.rows() * matrix.columns()),
+                    matrixBytes(matrix)};
+        }
+
+        // The columns of the right operand of the matrix-matrix
+        // multiplication, which takes the matrix as the left one.
+        constexpr size_t GEMM_COLUMNS{16};
+
+        // The rows of the matrices of the arena, into which the matrix is
+        // cut.
+        constexpr size_t ARENA_MATRIX_ROWS{64};
+
+        // A level-1 operation on vectors of as many elements as the matrix,
+        // so that it moves about as many bytes per vector as the
+        // transformations. The operation gets x, y and a result vector z,
+        // and each element costs the given flops and vector accesses.
+        PreparedKernel preparedBlas1(
+            const SOAMatrix & matrix, const double flopsPerElement,
+            const double vectorAccesses,
+            float (*operation)(const AVXVector &, AVXVector &,
+                               AVXVector &)) noexcept
+        {
+            const auto size = matrix.rows() * matrix.columns();
+            const auto x = make_shared<const AVXVector>(randomVector(size));
+            const auto y = make_shared<AVXVector>(randomVector(size));
+            const auto z = make_shared<AVXVector>(size);
+            return {[x, y, z, operation]() { return operation(*x, *y, *z); },
+                    flopsPerElement * static_cast<double>(size),
+                    vectorAccesses * static_cast<double>(size * sizeof(float))};
+        }
+
+        // Every parallel kernel of avx2-variant-mt.h and avx2-blas1-mt.h is
+        // registered here, so that it has to pass the same scaling harness.
+        // The kernels that do not transform the input vector by the matrix
+        // derive operands of the same scale from them. The AsyncTransformer
+        // is not registered, as it overlaps whole jobs on its own threads
+        // instead of splitting a call among the OpenMP threads, and neither
+        // are the solvers, which are built on the registered kernels.
+        const ParallelKernel PARALLEL_KERNELS[]{
+            {"avx2-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 return preparedTransform(
+                     matrix, [&matrix, &inputVector](AVXVector & result) {
+                         transformMultiThreaded(matrix, inputVector, result);
+                     });
+             }},
+            {"avx2-split-columns-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 return preparedTransform(
+                     matrix, [&matrix, &inputVector](AVXVector & result) {
+                         transformSplitColumnsMultiThreaded(
+                             matrix, inputVector, TransformOptions{}, result);
+                     });
+             }},
+            {"avx2-split-columns-mt-reproducible",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 TransformOptions options{};
+                 options.reductionMode = ReductionMode::REPRODUCIBLE;
+                 return preparedTransform(
+                     matrix,
+                     [&matrix, &inputVector, options](AVXVector & result) {
+                         transformSplitColumnsMultiThreaded(
+                             matrix, inputVector, options, result);
+                     });
+             }},
+            {"avx2-packed-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 const auto packed = make_shared<const PackedMatrix>(matrix);
+                 return preparedTransform(
+                     matrix, [packed, &inputVector](AVXVector & result) {
+                         transformPackedMultiThreaded(*packed, inputVector,
+                                                      result);
+                     });
+             }},
+            {"avx2-plan-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 // The plan binds the count of threads, which the harness
+                 // sets before each measurement. The warm-up call of the
+                 // measurement then creates the plan for it.
+                 const auto plan = make_shared<unique_ptr<TransformPlan>>();
+                 return preparedTransform(
+                     matrix, [plan, &matrix, &inputVector](AVXVector & result) {
+                         const auto threads =
+                             static_cast<size_t>(omp_get_max_threads());
+                         if (!*plan || (*plan)->threads() != threads)
+                         {
+                             PlanOptions options{};
+                             options.threads = threads;
+                             *plan = make_unique<TransformPlan>(
+                                 matrix.rows(), matrix.columns(), options);
+                         }
+                         executeMultiThreaded(**plan, matrix, inputVector,
+                                              result);
+                     });
+             }},
+            {"avx2-ger-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 // Updates a copy of the matrix by the input vector and a
+                 // vector of its rows, with a small factor that keeps the
+                 // elements in range over the calls.
+                 const auto updated = make_shared<SOAMatrix>(matrix);
+                 const auto u =
+                     make_shared<const AVXVector>(randomVector(matrix.rows()));
+                 return PreparedKernel{
+                     [updated, u, &inputVector]() {
+                         gerMultiThreaded(*updated, 1.0e-6F, *u, inputVector);
+                         return updated->at(0, 0);
+                     },
+                     2.0 * static_cast<double>(matrix.rows() *
+                                               matrix.columns()),
+                     2.0 * matrixBytes(matrix)};
+             }},
+            {"avx2-gemm-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 const auto b = make_shared<const SOAMatrix>(
+                     randomMatrix(matrix.columns(), GEMM_COLUMNS));
+                 return PreparedKernel{
+                     [&matrix, b]() {
+                         return multiplyMultiThreaded(matrix, *b).at(0, 0);
+                     },
+                     2.0 * static_cast<double>(matrix.rows() *
+                                               matrix.columns() * GEMM_COLUMNS),
+                     matrixBytes(matrix) + 2.0 * matrixBytes(*b)};
+             }},
+            {"avx2-arena-mt",
+             [](const SOAMatrix & matrix, const AVXVector & inputVector) {
+                 // Cuts the matrix into matrices of ARENA_MATRIX_ROWS rows,
+                 // each transforming the input vector.
+                 const auto matrices = make_shared<MatrixArena>();
+                 const auto inputs = make_shared<VectorArena>();
+                 const auto packsPerColumn = padSize(matrix.rows());
+                 for (size_t firstRow{0}; firstRow < matrix.rows();
+                      firstRow += ARENA_MATRIX_ROWS)
+                 {
+                     const auto rows =
+                         min(ARENA_MATRIX_ROWS, matrix.rows() - firstRow);
+                     const auto m = matrices->add(rows, matrix.columns());
+                     for (size_t c{0}; c < matrix.columns(); ++c)
+                     {
+                         copy_n(matrix.packs().begin() +
+                                    static_cast<int64_t>(
+                                        c * packsPerColumn +
+                                        firstRow / NUM_FLOATS_PER_AVX_REGISTER),
+                                padSize(rows),
+                                matrices->packs().begin() +
+                                    static_cast<int64_t>(
+                                        matrices->firstPack(m) +
+                                        c * padSize(rows)));
+                     }
+                     inputs->add(inputVector);
+                 }
+                 const auto results =
+                     make_shared<VectorArena>(resultArena(*matrices));
+                 return PreparedKernel{
+                     [matrices, inputs, results]() {
+                         transformArenaMultiThreaded(*matrices, *inputs,
+                                                     *results);
+                         return results->at(0, 0);
+                     },
+                     2.0 * static_cast<double>(matrix.rows() *
+                                               matrix.columns()),
+                     matrixBytes(matrix)};
+             }},
+            {"blas1-dot-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 2.0, 2.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector &) {
+                         return dotMultiThreaded(x, y);
+                     });
+             }},
+            {"blas1-squared-norm-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 2.0, 1.0,
+                     [](const AVXVector & x, AVXVector &, AVXVector &) {
+                         return squaredNormMultiThreaded(x);
+                     });
+             }},
+            {"blas1-norm-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 2.0, 1.0,
+                     [](const AVXVector & x, AVXVector &, AVXVector &) {
+                         return normMultiThreaded(x);
+                     });
+             }},
+            {"blas1-dot-and-squared-norm-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 4.0, 2.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector &) {
+                         return dotAndSquaredNormMultiThreaded(x, y).first;
+                     });
+             }},
+            {"blas1-scale-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 1.0, 2.0,
+                     [](const AVXVector &, AVXVector & y, AVXVector &) {
+                         scaleMultiThreaded(-1.0F, y);
+                         return y.at(0);
+                     });
+             }},
+            {"blas1-axpy-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 2.0, 3.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector &) {
+                         axpyMultiThreaded(1.0e-6F, x, y);
+                         return y.at(0);
+                     });
+             }},
+            {"blas1-axpby-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 3.0, 3.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector &) {
+                         axpbyMultiThreaded(0.5F, x, 0.5F, y);
+                         return y.at(0);
+                     });
+             }},
+            {"blas1-axpby-and-squared-norm-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 5.0, 3.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector &) {
+                         return axpbyAndSquaredNormMultiThreaded(0.5F, x, 0.5F,
+                                                                 y);
+                     });
+             }},
+            {"blas1-add-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 1.0, 3.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector & z) {
+                         addMultiThreaded(x, y, z);
+                         return z.at(0);
+                     });
+             }},
+            {"blas1-multiply-elementwise-mt",
+             [](const SOAMatrix & matrix, const AVXVector &) {
+                 return preparedBlas1(
+                     matrix, 1.0, 3.0,
+                     [](const AVXVector & x, AVXVector & y, AVXVector & z) {
+                         multiplyElementwiseMultiThreaded(x, y, z);
+                         return z.at(0);
+                     });
+             }},
+        };
+
+        struct PanelScheduler
+        {
+            const char * name;
+            void (*run)(size_t, const function<void(size_t)> &);
+        };
+
+        // The schedulers of the row panels of the triangular transformation,
+        // whose panels grow in cost from the first to the last.
+        const PanelScheduler PANEL_SCHEDULERS[]{
+            {"triangular-static",
+             [](const size_t panels, const function<void(size_t)> & task) {
+#pragma omp parallel for schedule(static)
+                 for (int64_t panel = 0; panel < static_cast<int64_t>(panels);
+                      ++panel)
+                 {
+                     task(static_cast<size_t>(panel));
+                 }
+             }},
+            {"triangular-work-stealing",
+             [](const size_t panels, const function<void(size_t)> & task) {
+                 scheduling::runWorkStealing(panels, task);
+             }},
+        };
+
+        // The row packs per panel of the triangular transformation.
+        constexpr size_t TRIANGULAR_PANEL_PACKS{4};
+
+        // The columns of the lower triangle that the rows of the panel read,
+        // that is up to the diagonal element of its last row.
+        size_t triangularColumns(const SOAMatrix & matrix,
+                                 const size_t panel) noexcept
+        {
+            return min(matrix.columns(), (panel + 1) * TRIANGULAR_PANEL_PACKS *
+                                             NUM_FLOATS_PER_AVX_REGISTER);
+        }
+
+        // Transforms the row packs of one panel by the lower triangle of the
+        // matrix, which makes the cost of a panel grow with its index.
+        void transformTriangularPanel(const SOAMatrix & matrix,
+                                      const AVXVector & inputVector,
+                                      AVXVector & result,
+                                      const size_t panel) noexcept
+        {
+            const auto packsPerColumn = padSize(matrix.rows());
+            const auto firstPack = panel * TRIANGULAR_PANEL_PACKS;
+            const auto lastPack =
+                min(firstPack + TRIANGULAR_PANEL_PACKS, packsPerColumn);
+            auto & resultPacks = result.packs();
+            fill(resultPacks.begin() + static_cast<int64_t>(firstPack),
+                 resultPacks.begin() + static_cast<int64_t>(lastPack),
+                 AVXPack{});
+
+            const auto columns = triangularColumns(matrix, panel);
+            for (size_t c{0}; c < columns; ++c)
+            {
+                const auto input =
+                    inputVector.packs()[c / NUM_FLOATS_PER_AVX_REGISTER]
+                                       [c % NUM_FLOATS_PER_AVX_REGISTER];
+                const auto * column =
+                    matrix.packs().data() + c * packsPerColumn;
+                for (auto p = firstPack; p < lastPack; ++p)
+                {
+                    for (size_t k{0}; k < NUM_FLOATS_PER_AVX_REGISTER; ++k)
+                    {
+                        resultPacks[p][k] += column[p][k] * input;
+                    }
+                }
+            }
+        }
+
+        const char * procBindName(const omp_proc_bind_t procBind) noexcept
+        {
+            switch (procBind)
+            {
+            case omp_proc_bind_false:
+                return "false";
+            case omp_proc_bind_true:
+                return "true";
+            case omp_proc_bind_master:
+                return "master";
+            case omp_proc_bind_close:
+                return "close";
+            case omp_proc_bind_spread:
+                return "spread";
+            }
+            return "unknown";
+        }
+
+        // Measures the kernel with the given count of threads, relating
+        // the time to the time of one thread. The strong scaling keeps the
+        // work of a single thread, so that the ideal speedup equals the
+        // count of threads. The weak scaling grows the work with the
+        // threads, so that the ideal time stays constant.
+        BenchmarkRecord measureScaling(
+            const ParallelKernel & kernel, const PreparedKernel & prepared,
+            const bool strongScaling, const int threads,
+            const SOAMatrix & matrix, const size_t repetitions,
+            double & singleThreadNanoseconds) noexcept
+        {
+            omp_set_num_threads(threads);
+
+            auto checksum = 0.0F;
+            const auto timing = measure(
+                repetitions, [&]() { checksum = prepared.run(); });
+
+            if (threads == 1)
+            {
+                singleThreadNanoseconds = timing.medianNanoseconds;
+            }
+
+            const auto relativeTime =
+                timing.medianNanoseconds > 0.0
+                    ? singleThreadNanoseconds / timing.medianNanoseconds
+                    : 0.0;
+            const auto speedup =
+                strongScaling ? relativeTime : relativeTime * threads;
+
+            return BenchmarkRecord{}
+                .add("benchmark", "scaling")
+                .add("mode", strongScaling ? "strong" : "weak")
+                .add("variant", kernel.name)
+                .add("threads", static_cast<size_t>(threads))
+                .add("procBind", procBindName(omp_get_proc_bind()))
+                .add("rows", matrix.rows())
+                .add("columns", matrix.columns())
+                .add(timing, prepared.flops, prepared.bytes)
+                .add("speedup", speedup)
+                .add("efficiency", speedup / threads)
+                .add("checksum", double{checksum});
+        }
+
+        // Measures the triangular transformation of each scheduler with the
+        // given count of threads. The work-stealing records relate their time
+        // to the one of the static split with as many threads.
+        void measureTriangular(const SOAMatrix & matrix,
+                               const AVXVector & inputVector,
+                               const size_t repetitions,
+                               const int maxThreads,
+                               vector<BenchmarkRecord> & records) noexcept
+        {
+            const auto rows = matrix.rows();
+            const auto panels = (padSize(rows) + TRIANGULAR_PANEL_PACKS - 1) /
+                                TRIANGULAR_PANEL_PACKS;
+            auto packs = 0.0;
+            for (size_t panel{0}; panel < panels; ++panel)
+            {
+                const auto panelPacks =
+                    min(TRIANGULAR_PANEL_PACKS,
+                        padSize(rows) - panel * TRIANGULAR_PANEL_PACKS);
+                packs += static_cast<double>(
+                    panelPacks * triangularColumns(matrix, panel));
+            }
+            const auto flops = 2.0 * NUM_FLOATS_PER_AVX_REGISTER * packs;
+            const auto bytes = static_cast<double>(sizeof(AVXPack)) * packs;
+
+            AVXVector result(rows);
+            const function<void(size_t)> task = [&](const size_t panel) {
+                transformTriangularPanel(matrix, inputVector, result, panel);
+            };
+
+            vector<double> staticNanoseconds(
+                static_cast<size_t>(maxThreads) + 1);
+            for (auto && scheduler : PANEL_SCHEDULERS)
+            {
+                auto singleThreadNanoseconds = 0.0;
+                const auto isStatic = &scheduler == &PANEL_SCHEDULERS[0];
+                for (auto threads = 1; threads <= maxThreads; ++threads)
+                {
+                    omp_set_num_threads(threads);
+                    const auto timing = measure(
+                        repetitions, [&]() { scheduler.run(panels, task); });
+
+                    if (threads == 1)
+                    {
+                        singleThreadNanoseconds = timing.medianNanoseconds;
+                    }
+                    auto & staticTime =
+                        staticNanoseconds[static_cast<size_t>(threads)];
+                    if (isStatic)
+                    {
+                        staticTime = timing.medianNanoseconds;
+                    }
+
+                    const auto speedup =
+                        timing.medianNanoseconds > 0.0
+                            ? singleThreadNanoseconds /
+                                  timing.medianNanoseconds
+                            : 0.0;
+                    auto record =
+                        BenchmarkRecord{}
+                            .add("benchmark", "scaling")
+                            .add("mode", "triangular")
+                            .add("variant", scheduler.name)
+                            .add("threads", static_cast<size_t>(threads))
+                            .add("procBind", procBindName(omp_get_proc_bind()))
+                            .add("rows", rows)
+                            .add("columns", matrix.columns())
+                            .add(timing, flops, bytes)
+                            .add("speedup", speedup)
+                            .add("efficiency", speedup / threads);
+                    if (!isStatic && timing.medianNanoseconds > 0.0)
+                    {
+                        record.add("speedupOverStatic",
+                                   staticTime / timing.medianNanoseconds);
+                    }
+                    records.push_back(
+                        record.add("checksum", double{result.at(rows - 1)}));
+                }
+            }
+        }
+    }
+
+    void runScalingBenchmark(const BenchmarkArguments & arguments,
+                             vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{1000});
+        const auto columns = arguments.get("columns", size_t{8192});
+        const auto rowsPerThread = arguments.get("rowsPerThread", size_t{1024});
+        const auto triangularSize =
+            arguments.get("triangularSize", size_t{2048});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+        const auto defaultThreads = omp_get_max_threads();
+        const auto maxThreads = static_cast<int>(
+            arguments.get("maxThreads", static_cast<size_t>(defaultThreads)));
+        const auto variant = arguments.get("variant", "all");
+
+        for (auto && kernel : PARALLEL_KERNELS)
+        {
+            if (variant != "all" && variant != kernel.name)
+            {
+                continue;
+            }
+
+            auto singleThreadNanoseconds = 0.0;
+            const auto matrix = randomMatrix(rows, columns);
+            const auto inputVector = randomVector(columns);
+            const auto prepared = kernel.prepare(matrix, inputVector);
+            for (auto threads = 1; threads <= maxThreads; ++threads)
+            {
+                records.push_back(measureScaling(kernel, prepared, true,
+                                                 threads, matrix, repetitions,
+                                                 singleThreadNanoseconds));
+            }
+
+            for (auto threads = 1; threads <= maxThreads; ++threads)
+            {
+                // The work of every kernel grows with the rows, whether it
+                // splits the rows or the columns among the threads.
+                const auto weakMatrix = randomMatrix(
+                    rowsPerThread * static_cast<size_t>(threads), columns);
+                records.push_back(measureScaling(
+                    kernel, kernel.prepare(weakMatrix, inputVector), false,
+                    threads, weakMatrix, repetitions,
+                    singleThreadNanoseconds));
+            }
+        }
+
+        if (variant == "all" || variant.rfind("triangular", 0) == 0)
+        {
+            // A lower triangular matrix, whose last row panels cost the most,
+            // so that a static split of the panels leaves the first threads
+            // idle.
+            const auto matrix = randomMatrix(triangularSize, triangularSize);
+            const auto inputVector = randomVector(triangularSize);
+            measureTriangular(matrix, inputVector, repetitions, maxThreads,
+                              records);
+        }
+
+        omp_set_num_threads(defaultThreads);
+    }
+}
@@ -0,0 +1,126 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-solvers.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+using namespace matrixmultiplication::solvers;
+
+namespace
+{
+    using namespace matrixmultiplication::benchmark;
+
+    // Random off-diagonal elements small enough to keep the spectrum close
+    // to the diagonal, which grows from 1 to the given condition. Symmetric
+    // matrices are then positive definite.
+    SOAMatrix conditionedMatrix(const size_t size, const float condition,
+                                const bool symmetric) noexcept
+    {
+        auto matrix = randomMatrix(size, size);
+        const auto offDiagonalScale =
+            0.25F / sqrt(static_cast<float>(size));
+        for (size_t c{0}; c < size; ++c)
+        {
+            for (size_t r{0}; r < size; ++r)
+            {
+                if (symmetric && r < c)
+                {
+                    matrix.at(r, c) = matrix.at(c, r);
+                }
+                else if (r != c)
+                {
+                    matrix.at(r, c) *= offDiagonalScale;
+                }
+            }
+            matrix.at(c, c) =
+                1.0F + (condition - 1.0F) * static_cast<float>(c) /
+                           static_cast<float>(max(size - 1, size_t{1}));
+        }
+        return matrix;
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runSolversBenchmark(const BenchmarkArguments & arguments,
+                             vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto size = arguments.get("size", size_t{2048});
+        const auto condition =
+            static_cast<float>(arguments.get("condition", size_t{100}));
+        const auto restart = arguments.get("restart", size_t{30});
+        const auto repetitions = arguments.get("repetitions", size_t{10});
+
+        SolverOptions options{};
+        options.maxIterations = arguments.get("maxIterations", size_t{1000});
+        options.tolerance = 1e-5F;
+
+        const auto symmetricMatrix = conditionedMatrix(size, condition, true);
+        const auto matrix = conditionedMatrix(size, condition, false);
+        const auto rightHandSide = randomVector(size);
+
+        // The dominant eigenvalue is twice the others, so that the power
+        // iteration converges at a known rate.
+        auto dominantMatrix = symmetricMatrix;
+        dominantMatrix.at(0, 0) = 2.0F * condition;
+
+        for (auto multiThreaded : {false, true})
+        {
+            options.multiThreaded = multiThreaded;
+
+            // The matrix-vector product dominates every iteration, so the
+            // throughput counts only its operations and matrix traffic.
+            const auto record = [&](const char * solver, const Timing & timing,
+                                    const SolverResult & result) {
+                const auto iterations =
+                    static_cast<double>(max(result.iterations, size_t{1}));
+                records.push_back(
+                    BenchmarkRecord{}
+                        .add("benchmark", "solvers")
+                        .add("solver", solver)
+                        .add("variant", multiThreaded ? "avx2-mt" : "avx2")
+                        .add("size", size)
+                        .add("condition", static_cast<double>(condition))
+                        .add("iterations", result.iterations)
+                        .add("converged", size_t{result.converged})
+                        .add("residual", static_cast<double>(result.residual))
+                        .add(timing,
+                             2.0 * static_cast<double>(size * size) *
+                                 iterations,
+                             matrixBytes(matrix) * iterations)
+                        .add("nanosecondsPerIteration",
+                             timing.medianNanoseconds / iterations));
+            };
+
+            AVXVector solution(size);
+            SolverResult result{};
+
+            ConjugateGradient conjugateGradient{size};
+            const auto conjugateGradientTiming = measure(repetitions, [&]() {
+                solution = AVXVector(size);
+                result = conjugateGradient.solve(symmetricMatrix, rightHandSide,
+                                                 solution, options);
+            });
+            record("conjugate-gradient", conjugateGradientTiming, result);
+
+            RestartedGmres gmres{size, restart};
+            const auto gmresTiming = measure(repetitions, [&]() {
+                solution = AVXVector(size);
+                result = gmres.solve(matrix, rightHandSide, solution, options);
+            });
+            record("gmres", gmresTiming, result);
+
+            PowerIteration powerIteration{size};
+            float eigenvalue{0.0F};
+            const auto powerIterationTiming = measure(repetitions, [&]() {
+                solution = AVXVector(size, 1.0F);
+                result = powerIteration.solve(dominantMatrix, solution,
+                                              eigenvalue, options);
+            });
+            record("power-iteration", powerIterationTiming, result);
+            records.back().add("eigenvalue", static_cast<double>(eigenvalue));
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-sparse.h>
+#include <avx2-variant.h>
+
+#include <random>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace
+{
+    // Percentages of non-zero input elements, from one-hot like inputs up to
+    // dense ones.
+    constexpr size_t NON_ZERO_PERCENTS[]{1, 2, 5, 10, 20, 50, 100};
+
+    // Random but reproducible input vector with about the given percentage
+    // of non-zero elements at random positions.
+    AVXVector sparseVector(const size_t size, const size_t nonZeroPercent)
+    {
+        mt19937 generator{42};
+        uniform_int_distribution<size_t> percent{0, 99};
+        uniform_real_distribution<float> value{-1.0F, 1.0F};
+
+        AVXVector vector(size, 0.0F);
+        for (size_t i{0}; i < size; ++i)
+        {
+            if (percent(generator) < nonZeroPercent)
+            {
+                vector.at(i) = value(generator);
+            }
+        }
+        return vector;
+    }
+}
+
+namespace matrixmultiplication::benchmark
+{
+    void runSparseBenchmark(const BenchmarkArguments & arguments,
+                            vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{256});
+        const auto columns = arguments.get("columns", size_t{16384});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        const auto matrix = randomMatrix(rows, columns);
+        const auto columnBytes =
+            static_cast<double>(padSize(rows) * sizeof(AVXPack));
+
+        for (auto nonZeroPercent : NON_ZERO_PERCENTS)
+        {
+            const auto inputVector = sparseVector(columns, nonZeroPercent);
+            const auto inputElements = nonZeroElements(inputVector);
+            const auto nonZeros = static_cast<double>(inputElements.size());
+
+            // The dense transformation reads every column, the sparse ones
+            // only the non-zero ones.
+            const auto record = [&](const char * variant,
+                                    const Timing & timing,
+                                    const double columnsRead) {
+                records.push_back(
+                    BenchmarkRecord{}
+                        .add("benchmark", "sparse")
+                        .add("variant", variant)
+                        .add("rows", rows)
+                        .add("columns", columns)
+                        .add("nonZeroPercent", nonZeroPercent)
+                        .add("nonZeros", inputElements.size())
+                        .add(timing, 2.0 * static_cast<double>(rows) * nonZeros,
+                             columnBytes * columnsRead));
+            };
+
+            AVXVector result(rows);
+            record("dense", measure(repetitions, [&]() {
+                       result = transform(matrix, inputVector);
+                   }),
+                   static_cast<double>(columns));
+            record("sparse-vector", measure(repetitions, [&]() {
+                       result = transformSparse(matrix, inputVector);
+                   }),
+                   nonZeros);
+            record("sparse-elements", measure(repetitions, [&]() {
+                       result = transformSparse(matrix, inputElements);
+                   }),
+                   nonZeros);
+        }
+    }
+}
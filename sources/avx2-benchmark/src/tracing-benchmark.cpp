@@ -0,0 +1,74 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-variant-mt.h>
+#include <tracing.h>
+
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runTracingBenchmark(const BenchmarkArguments & arguments,
+                             vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto shapes =
+            parseShapes(arguments.get("shapes", "64x65536,1024x4096"));
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+        const auto traceFile = arguments.get("traceFile", "");
+
+        for (const auto & shape : shapes)
+        {
+            const auto matrix = randomMatrix(shape.rows, shape.columns);
+            const auto inputVector = randomVector(shape.columns);
+            const auto flops = 2.0 * static_cast<double>(shape.rows) *
+                               static_cast<double>(shape.columns);
+            const auto bytes = matrixBytes(matrix);
+
+            const auto compare = [&](const char * variant, auto && call) {
+                tracing::setEnabled(false);
+                const auto untraced = measure(repetitions, call);
+                tracing::setEnabled(true);
+                const auto traced = measure(repetitions, call);
+                tracing::setEnabled(false);
+
+                const auto overheadPercent =
+                    100.0 * (traced.medianNanoseconds /
+                                 untraced.medianNanoseconds -
+                             1.0);
+                for (const auto & [mode, timing] :
+                     {make_pair("disabled", untraced),
+                      make_pair("enabled", traced)})
+                {
+                    records.push_back(
+                        BenchmarkRecord{}
+                            .add("benchmark", "tracing")
+                            .add("variant", variant)
+                            .add("rows", shape.rows)
+                            .add("columns", shape.columns)
+                            .add("compiledIn",
+                                 tracing::COMPILED_IN ? "yes" : "no")
+                            .add("tracing", mode)
+                            .add("overheadPercent", overheadPercent)
+                            .add(timing, flops, bytes));
+                }
+            };
+
+            compare("avx2-mt", [&]() {
+                const auto result = transformMultiThreaded(matrix, inputVector);
+            });
+            compare("avx2-mt-split-columns", [&]() {
+                const auto result =
+                    transformSplitColumnsMultiThreaded(matrix, inputVector);
+            });
+        }
+
+        // The trace holds the newest events of the traced runs.
+        if (!traceFile.empty() && !tracing::writeChromeTrace(traceFile))
+        {
+            cerr << "could not write the trace to " << traceFile << endl;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-matrix-updates.h>
+#include <avx2-variant-mt.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::benchmark
+{
+    void runUpdatesBenchmark(const BenchmarkArguments & arguments,
+                             vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{4096});
+        const auto columns = arguments.get("columns", size_t{4096});
+        const auto repetitions = arguments.get("repetitions", size_t{20});
+        const auto accessorRepetitions =
+            arguments.get("accessorRepetitions", size_t{2});
+
+        auto matrix = randomMatrix(rows, columns);
+        const auto u = randomVector(rows);
+        const auto v = randomVector(columns);
+        const auto bytes = matrixBytes(matrix);
+        const auto flops = 2.0 * static_cast<double>(rows * columns);
+
+        const auto record = [&](const char * operation, const Timing & timing,
+                                const double operationFlops,
+                                const double operationBytes) {
+            records.push_back(BenchmarkRecord{}
+                                  .add("benchmark", "updates")
+                                  .add("operation", operation)
+                                  .add("rows", rows)
+                                  .add("columns", columns)
+                                  .add(timing, operationFlops, operationBytes));
+        };
+
+        // The rank-1 updates read and write the whole matrix. The alpha
+        // alternates, so that the values stay bounded over the runs.
+        auto alpha = 1.0F;
+        record("ger", measure(repetitions, [&]() {
+                   ger(matrix, alpha, u, v);
+                   alpha = -alpha;
+               }),
+               flops, 2.0 * bytes);
+
+        record("ger-mt", measure(repetitions, [&]() {
+                   gerMultiThreaded(matrix, alpha, u, v);
+                   alpha = -alpha;
+               }),
+               flops, 2.0 * bytes);
+
+        // The element-wise accessor path, which the updates replace.
+        record("ger-accessor", measure(accessorRepetitions, [&]() {
+                   for (size_t c{0}; c < columns; ++c)
+                   {
+                       for (size_t r{0}; r < rows; ++r)
+                       {
+                           matrix.at(r, c) += alpha * u.at(r) * v.at(c);
+                       }
+                   }
+                   alpha = -alpha;
+               }),
+               flops, 2.0 * bytes);
+
+        const auto columnBytes = static_cast<double>(
+            u.packs().size() * sizeof(AVXPack));
+        record("replaceColumn", measure(repetitions, [&]() {
+                   replaceColumn(matrix, columns / 2, u);
+               }),
+               0.0, 2.0 * columnBytes);
+
+        const auto rowBytes = static_cast<double>(columns * sizeof(float));
+        record("replaceRow", measure(repetitions, [&]() {
+                   replaceRow(matrix, rows / 2, v);
+               }),
+               0.0, 2.0 * rowBytes);
+    }
+}
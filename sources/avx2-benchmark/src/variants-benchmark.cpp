@@ -0,0 +1,75 @@
+#include "avx2-benchmark.h"
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+#include <profiled-transforms.h>
+#include <scalar-variant.h>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+using namespace matrixmultiplication::scalar;
+
+namespace matrixmultiplication::benchmark
+{
+    void runVariantsBenchmark(const BenchmarkArguments & arguments,
+                              vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto rows = arguments.get("rows", size_t{1000});
+        const auto columns = arguments.get("columns", size_t{1000});
+        const auto repetitions = arguments.get("repetitions", size_t{50});
+
+        const auto matrix = randomMatrix(rows, columns);
+        const auto inputVector = randomVector(columns);
+        const auto scalarMatrix = toScalarMatrix(matrix);
+        const auto scalarInputVector = toScalarVector(inputVector);
+        const auto flops = 2.0 * static_cast<double>(rows * columns);
+
+        const auto record = [&](const char * variant, const Timing & timing,
+                                const profiling::PerfStats & stats,
+                                const float checksum) {
+            auto result = BenchmarkRecord{}
+                              .add("benchmark", "variants")
+                              .add("variant", variant)
+                              .add("rows", rows)
+                              .add("columns", columns)
+                              .add(timing, flops, matrixBytes(matrix))
+                              .add("checksum", double{checksum});
+            records.push_back(addCounters(result, stats));
+        };
+
+        // The counters are read in a separate run, so that their reading
+        // does not distort the timing.
+        {
+            ScalarVector result;
+            const auto timing = measure(repetitions, [&]() {
+                result = scalar::transform(scalarMatrix, scalarInputVector);
+            });
+
+            profiling::PerfStats stats;
+            profiling::transform(scalarMatrix, scalarInputVector, stats);
+            record("scalar", timing, stats, result.at(0));
+        }
+
+        {
+            AVXVector result(rows);
+            const auto timing = measure(repetitions, [&]() {
+                result = avx2::transform(matrix, inputVector);
+            });
+
+            profiling::PerfStats stats;
+            profiling::transform(matrix, inputVector, stats);
+            record("avx2", timing, stats, result.at(0));
+        }
+
+        {
+            AVXVector result(rows);
+            const auto timing = measure(repetitions, [&]() {
+                result = avx2::transformMultiThreaded(matrix, inputVector);
+            });
+
+            profiling::PerfStats stats;
+            profiling::transformMultiThreaded(matrix, inputVector, stats);
+            record("avx2-mt", timing, stats, result.at(0));
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "avx2-model.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // Stores many matrices of different shapes contiguously in one vector of
+    // packs, each in the column-major layout of SOAMatrix. Adding matrices
+    // may reallocate the packs, which invalidates pointers into them.
+    class MatrixArena
+    {
+        struct Member
+        {
+            std::size_t rows;
+            std::size_t columns;
+            std::size_t firstPack;
+        };
+
+        std::vector<Member> _members;
+        std::vector<AVXPack> _packs;
+
+      public:
+        static constexpr float INITIAL_VALUE = 0.0F;
+
+        // Reserves the space for the counts of matrices and packs, so that
+        // adding them allocates nothing.
+        void reserve(const std::size_t matrices,
+                     const std::size_t packs) noexcept;
+
+        // Appends a matrix of the shape initialized like a SOAMatrix and
+        // returns its index.
+        std::size_t add(const std::size_t rows, const std::size_t columns,
+                        const float initialValue = INITIAL_VALUE) noexcept;
+
+        // Appends a copy of the matrix and returns its index.
+        std::size_t add(const SOAMatrix & matrix) noexcept;
+
+        // Count of the matrices.
+        std::size_t size() const noexcept;
+
+        std::size_t rows(const std::size_t m) const noexcept;
+        std::size_t columns(const std::size_t m) const noexcept;
+
+        // Index of the first pack of the matrix in the arena, which is
+        // followed by its columns of padSize(rows) packs each.
+        std::size_t firstPack(const std::size_t m) const noexcept;
+
+        std::vector<AVXPack> & packs() noexcept;
+        const std::vector<AVXPack> & packs() const noexcept;
+
+        float & at(const std::size_t m, const std::size_t r,
+                   const std::size_t c) noexcept;
+        float at(const std::size_t m, const std::size_t r,
+                 const std::size_t c) const noexcept;
+    };
+
+    // Stores many vectors of different sizes contiguously in one vector of
+    // packs, each padded like an AVXVector. Adding vectors may reallocate
+    // the packs, which invalidates pointers into them.
+    class VectorArena
+    {
+        struct Member
+        {
+            std::size_t elements;
+            std::size_t firstPack;
+        };
+
+        std::vector<Member> _members;
+        std::vector<AVXPack> _packs;
+
+      public:
+        static constexpr float INITIAL_VALUE = 0.0F;
+
+        // Reserves the space for the counts of vectors and packs, so that
+        // adding them allocates nothing.
+        void reserve(const std::size_t vectors,
+                     const std::size_t packs) noexcept;
+
+        // Appends a vector of the size initialized like an AVXVector and
+        // returns its index.
+        std::size_t add(const std::size_t elements,
+                        const float initialValue = INITIAL_VALUE) noexcept;
+
+        // Appends a copy of the vector and returns its index.
+        std::size_t add(const AVXVector & vector) noexcept;
+
+        // Count of the vectors.
+        std::size_t size() const noexcept;
+
+        std::size_t elements(const std::size_t v) const noexcept;
+
+        // Index of the first pack of the vector in the arena.
+        std::size_t firstPack(const std::size_t v) const noexcept;
+
+        std::vector<AVXPack> & packs() noexcept;
+        const std::vector<AVXPack> & packs() const noexcept;
+
+        float & at(const std::size_t v, const std::size_t i) noexcept;
+        float at(const std::size_t v, const std::size_t i) const noexcept;
+    };
+
+    // Creates an arena with one vector per matrix of the arena, sized by the
+    // rows of the matrix, to take the results of transforming by them.
+    VectorArena resultArena(const MatrixArena & matrices) noexcept;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "avx2-model.h"
+
+#include <limits>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+namespace matrixmultiplication::avx2
+{
+    // Built-in operations a transformation applies to each result pack in
+    // registers right before storing it, so that they do not cost an extra
+    // pass over the result:
+    //     result = clamp(scale * result + bias, lowerBound, upperBound)
+    // The defaults leave the result unchanged.
+    struct Epilogue
+    {
+        float scale{1.0F};
+
+        // Optional, must have as many elements as the result.
+        const AVXVector * bias{nullptr};
+
+        float lowerBound{-std::numeric_limits<float>::infinity()};
+        float upperBound{std::numeric_limits<float>::infinity()};
+    };
+
+    // Epilogue of a ReLU activation with an optional bias added before.
+    inline Epilogue relu(const AVXVector * bias = nullptr) noexcept
+    {
+        return Epilogue{1.0F, bias, 0.0F};
+    }
+
+    // How a transformation stores its finalized result packs. Streaming uses
+    // non-temporal stores, which bypass the caches, so that a result far
+    // larger than the last level cache does not evict the matrix data.
+    enum class StoreMode
+    {
+        // Streams results larger than the last level cache of the host.
+        AUTOMATIC,
+        CACHED,
+        STREAMING
+    };
+
+    // Resolves whether finalized result packs of a result with the given
+    // count of elements are stored with non-temporal stores.
+    bool usesStreamingStores(const StoreMode storeMode,
+                             const std::size_t resultElements) noexcept;
+
+    // Stores a finalized result pack. Non-temporal stores must be followed
+    // by a _mm_sfence() before the result is handed over.
+    inline void storeResult(float * data, const __m256 & value,
+                            const bool streaming) noexcept
+    {
+        if (streaming)
+        {
+            _mm256_stream_ps(data, value);
+        }
+        else
+        {
+            _mm256_store_ps(data, value);
+        }
+    }
+
+    // Applies an Epilogue to result packs with its constant operands kept in
+    // registers.
+    class EpilogueOperation
+    {
+        __m256 _scale;
+        const AVXPack * _bias;
+        __m256 _lowerBound;
+        __m256 _upperBound;
+
+      public:
+        explicit EpilogueOperation(const Epilogue & epilogue) noexcept
+            : _scale(_mm256_set1_ps(epilogue.scale)),
+              _bias(epilogue.bias != nullptr ? epilogue.bias->packs().data()
+                                             : nullptr),
+              _lowerBound(_mm256_set1_ps(epilogue.lowerBound)),
+              _upperBound(_mm256_set1_ps(epilogue.upperBound))
+        {
+        }
+
+        __m256 operator()(const __m256 & value,
+                          const std::size_t packIndex) const noexcept
+        {
+            auto result = _mm256_mul_ps(value, this->_scale);
+            if (this->_bias != nullptr)
+            {
+                result = _mm256_add_ps(
+                    result, _mm256_load_ps(this->_bias[packIndex].data()));
+            }
+
+            // min and max return their second operand if any operand is
+            // NaN, so the result is kept second to let NaNs pass through.
+            result = _mm256_min_ps(this->_upperBound, result);
+            return _mm256_max_ps(this->_lowerBound, result);
+        }
+    };
+
+    // An epilogue may have changed the padding elements in the last pack of
+    // the result, but users of the vector rely on the padding.
+    inline void restorePadding(AVXVector & vector) noexcept
+    {
+        // Resizing to the same size only restores the padding.
+        vector.resize(vector.size());
+    }
+}
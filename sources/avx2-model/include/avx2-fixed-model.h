@@ -0,0 +1,128 @@
+#pragma once
+
+#include "avx2-model.h"
+
+#include <array>
+#include <cstddef>
+
+namespace matrixmultiplication::avx2
+{
+    // Count of packs holding the given count of elements, known at compile
+    // time.
+    constexpr std::size_t packCount(const std::size_t size) noexcept
+    {
+        return (size + NUM_FLOATS_PER_AVX_REGISTER - 1) /
+               NUM_FLOATS_PER_AVX_REGISTER;
+    }
+
+    // Like AVXVector, but with the size fixed at compile time and the packs
+    // on the stack instead of the heap.
+    template <std::size_t N> class FixedVector
+    {
+        static_assert(N > 0);
+
+      public:
+        static constexpr std::size_t PACKS{packCount(N)};
+
+      private:
+        std::array<AVXPack, PACKS> _packs;
+
+      public:
+        explicit FixedVector(const float initialValue = 0.0F) noexcept
+        {
+            for (auto && pack : this->_packs)
+            {
+                pack.fill(PADDING_VALUE);
+            }
+            for (std::size_t i{0}; i < N; ++i)
+            {
+                this->at(i) = initialValue;
+            }
+        }
+
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        std::array<AVXPack, PACKS> & packs() noexcept
+        {
+            return this->_packs;
+        }
+
+        const std::array<AVXPack, PACKS> & packs() const noexcept
+        {
+            return this->_packs;
+        }
+
+        float & at(const std::size_t i) noexcept
+        {
+            return this->_packs[i / NUM_FLOATS_PER_AVX_REGISTER]
+                               [i % NUM_FLOATS_PER_AVX_REGISTER];
+        }
+
+        float at(const std::size_t i) const noexcept
+        {
+            return this->_packs[i / NUM_FLOATS_PER_AVX_REGISTER]
+                               [i % NUM_FLOATS_PER_AVX_REGISTER];
+        }
+    };
+
+    // Like SOAMatrix, but with the shape fixed at compile time and the packs
+    // on the stack instead of the heap.
+    template <std::size_t R, std::size_t C> class FixedMatrix
+    {
+        static_assert(R > 0 && C > 0);
+
+      public:
+        static constexpr std::size_t PACKS_PER_COLUMN{packCount(R)};
+
+      private:
+        std::array<AVXPack, PACKS_PER_COLUMN * C> _packs;
+
+      public:
+        explicit FixedMatrix(const float initialValue = 0.0F) noexcept
+        {
+            for (auto && pack : this->_packs)
+            {
+                pack.fill(PADDING_VALUE);
+            }
+            for (std::size_t c{0}; c < C; ++c)
+            {
+                for (std::size_t r{0}; r < R; ++r)
+                {
+                    this->at(r, c) = initialValue;
+                }
+            }
+        }
+
+        static constexpr std::size_t rows() noexcept
+        {
+            return R;
+        }
+
+        static constexpr std::size_t columns() noexcept
+        {
+            return C;
+        }
+
+        const std::array<AVXPack, PACKS_PER_COLUMN * C> & packs() const noexcept
+        {
+            return this->_packs;
+        }
+
+        float & at(const std::size_t r, const std::size_t c) noexcept
+        {
+            return this->_packs[r / NUM_FLOATS_PER_AVX_REGISTER +
+                                c * PACKS_PER_COLUMN]
+                               [r % NUM_FLOATS_PER_AVX_REGISTER];
+        }
+
+        float at(const std::size_t r, const std::size_t c) const noexcept
+        {
+            return this->_packs[r / NUM_FLOATS_PER_AVX_REGISTER +
+                                c * PACKS_PER_COLUMN]
+                               [r % NUM_FLOATS_PER_AVX_REGISTER];
+        }
+    };
+}
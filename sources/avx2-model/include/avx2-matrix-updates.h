@@ -0,0 +1,30 @@
+#pragma once
+
+#include "avx2-model.h"
+
+#include <cstddef>
+
+namespace matrixmultiplication::avx2
+{
+    // Performs the rank-1 update A += alpha * u * v^T in place, with u of
+    // the size of the rows and v of the size of the columns. Each column is
+    // updated pack-wise by the broadcast of alpha * v[c] times u, while the
+    // padding of the matrix is kept.
+    void ger(SOAMatrix & matrix, const float alpha, const AVXVector & u,
+             const AVXVector & v) noexcept;
+
+    // Like ger, but for the columns [firstColumn, lastColumn) only, so that
+    // the columns can be split among threads.
+    void ger(SOAMatrix & matrix, const float alpha, const AVXVector & u,
+             const AVXVector & v, const std::size_t firstColumn,
+             const std::size_t lastColumn) noexcept;
+
+    // Replaces the column by the values, which are of the size of the rows.
+    // Thanks to the SOA layout, this copies whole packs.
+    void replaceColumn(SOAMatrix & matrix, const std::size_t column,
+                       const AVXVector & values) noexcept;
+
+    // Replaces the row by the values, which are of the size of the columns.
+    void replaceRow(SOAMatrix & matrix, const std::size_t row,
+                    const AVXVector & values) noexcept;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <vector>
 
 namespace matrixmultiplication::avx2
@@ -44,6 +45,12 @@ namespace matrixmultiplication::avx2
 
         std::size_t size() const noexcept;
 
+        // Changes the count of elements while keeping the existing elements.
+        // New elements get the INITIAL_VALUE and the padding is restored.
+        // Shrinking keeps the capacity, so that a vector constructed with the
+        // largest needed size can be reused without allocations.
+        void resize(const std::size_t elements) noexcept;
+
         float & at(const std::size_t i) noexcept;
         float at(const std::size_t i) const noexcept;
     };
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "avx2-model.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // The row packs of a panel, which the kernels of the packed matrices
+    // keep in registers.
+    constexpr std::size_t PACKED_MAX_ROW_PANEL_PACKS{8};
+
+    // How a PackedMatrix splits the matrix into panels.
+    struct PackedBlocking
+    {
+        // Row packs per row panel, from 1 to PACKED_MAX_ROW_PANEL_PACKS. The
+        // last row panel holds the remaining packs.
+        std::size_t rowPanelPacks{PACKED_MAX_ROW_PANEL_PACKS};
+
+        // Columns per column panel, a multiple of the floats per pack, so
+        // that each column panel starts at a pack of the input. Zero puts
+        // all columns into one panel.
+        std::size_t columnPanelColumns{0};
+    };
+
+    // A matrix repacked into the order in which the packed transformation
+    // consumes it, so that it reads the matrix as one linear stream. The
+    // column panels follow each other. Within a column panel the row panels
+    // follow each other, and within a row panel the columns, each with the
+    // packs of the row panel. The repacking costs a copy of the matrix and
+    // is meant to be done once, e.g. when loading a model.
+    class PackedMatrix
+    {
+        std::size_t _rows;
+        std::size_t _columns;
+        PackedBlocking _blocking;
+        std::vector<AVXPack> _packs;
+
+      public:
+        explicit PackedMatrix(const SOAMatrix & matrix,
+                              const PackedBlocking & blocking = {}) noexcept;
+
+        std::size_t rows() const noexcept;
+        std::size_t columns() const noexcept;
+
+        // The blocking with the column panel width resolved.
+        const PackedBlocking & blocking() const noexcept;
+
+        // The count of row panels of each column panel.
+        std::size_t rowPanels() const noexcept;
+
+        // The count of column panels.
+        std::size_t columnPanels() const noexcept;
+
+        // Index of the first pack of the row panel of the column panel.
+        std::size_t firstPack(const std::size_t columnPanel,
+                              const std::size_t rowPanel) const noexcept;
+
+        const std::vector<AVXPack> & packs() const noexcept;
+
+        float at(const std::size_t r, const std::size_t c) const noexcept;
+    };
+}
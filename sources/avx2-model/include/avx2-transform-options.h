@@ -0,0 +1,64 @@
+#pragma once
+
+#include "avx2-epilogue.h"
+#include "avx2-model.h"
+
+#include <cstdint>
+
+namespace matrixmultiplication::avx2
+{
+    // How multi-threaded transformations add up the partial results of
+    // their threads. Only the ones that split the columns among the threads
+    // have such partial results, the ones that split the rows are
+    // reproducible by construction.
+    enum class ReductionMode
+    {
+        // Each thread adds its partial result to the result as soon as it
+        // is done, so that the order of the additions and thereby the
+        // rounding may change from run to run.
+        FAST,
+
+        // The columns are split into chunks depending on the shape only,
+        // and the partial results of the chunks are added in a fixed tree,
+        // so that the result is the same bit by bit for any count of
+        // threads. Costs a partial result per chunk and the passes of the
+        // tree over them.
+        REPRODUCIBLE
+    };
+
+    // Tunables of the transformation variants.
+    struct TransformOptions
+    {
+        Epilogue epilogue{};
+
+        StoreMode storeMode{StoreMode::AUTOMATIC};
+
+        // How many packs ahead of the currently loaded pack the matrix data
+        // is prefetched. A column pass that reaches the end of its column
+        // thereby already prefetches the packs of the next column. The
+        // panels of transformMultiThreaded prefetch their own packs of the
+        // columns ahead instead, as many columns as the distance spans
+        // panels. Zero leaves it to the hardware prefetcher.
+        std::size_t prefetchDistance{0};
+
+        ReductionMode reductionMode{ReductionMode::FAST};
+    };
+
+    constexpr std::size_t CACHE_LINE_SIZE{64};
+
+    // Hints the caches to fetch the pack the given count of packs ahead. The
+    // address is computed without pointer arithmetic, because it may point
+    // behind the end of the matrix data, which is harmless for a prefetch.
+    // Only packs starting a cache line are prefetched, so that loops over
+    // consecutive packs issue one prefetch per line.
+    inline void prefetchAhead(const AVXPack & pack,
+                              const std::size_t distance) noexcept
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(pack.data()) +
+                             distance * sizeof(AVXPack);
+        if (address % CACHE_LINE_SIZE == 0)
+        {
+            _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0);
+        }
+    }
+}
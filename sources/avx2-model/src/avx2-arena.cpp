@@ -0,0 +1,200 @@
+#include "avx2-arena.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // Appends the packs of count elements set to the initial value and
+        // followed by the padding.
+        void appendPacks(vector<AVXPack> & packs, const size_t count,
+                         const float initialValue) noexcept
+        {
+            AVXPack pack{};
+            pack.fill(initialValue);
+            packs.insert(packs.end(), count / NUM_FLOATS_PER_AVX_REGISTER,
+                         pack);
+
+            const auto remainder = count % NUM_FLOATS_PER_AVX_REGISTER;
+            if (remainder > 0)
+            {
+                for (auto lane = remainder;
+                     lane < NUM_FLOATS_PER_AVX_REGISTER; ++lane)
+                {
+                    pack[lane] = PADDING_VALUE;
+                }
+                packs.push_back(pack);
+            }
+        }
+    }
+
+    void MatrixArena::reserve(const size_t matrices,
+                              const size_t packs) noexcept
+    {
+        this->_members.reserve(matrices);
+        this->_packs.reserve(packs);
+    }
+
+    size_t MatrixArena::add(const size_t rows, const size_t columns,
+                            const float initialValue) noexcept
+    {
+        assert(rows > 0);
+        assert(columns > 0);
+
+        this->_members.push_back(
+            Member{rows, columns, this->_packs.size()});
+        for (size_t c{0}; c < columns; ++c)
+        {
+            appendPacks(this->_packs, rows, initialValue);
+        }
+        return this->_members.size() - 1;
+    }
+
+    size_t MatrixArena::add(const SOAMatrix & matrix) noexcept
+    {
+        this->_members.push_back(
+            Member{matrix.rows(), matrix.columns(), this->_packs.size()});
+        this->_packs.insert(this->_packs.end(), matrix.packs().cbegin(),
+                            matrix.packs().cend());
+        return this->_members.size() - 1;
+    }
+
+    size_t MatrixArena::size() const noexcept
+    {
+        return this->_members.size();
+    }
+
+    size_t MatrixArena::rows(const size_t m) const noexcept
+    {
+        return this->_members.at(m).rows;
+    }
+
+    size_t MatrixArena::columns(const size_t m) const noexcept
+    {
+        return this->_members.at(m).columns;
+    }
+
+    size_t MatrixArena::firstPack(const size_t m) const noexcept
+    {
+        return this->_members.at(m).firstPack;
+    }
+
+    vector<AVXPack> & MatrixArena::packs() noexcept
+    {
+        return this->_packs;
+    }
+
+    const vector<AVXPack> & MatrixArena::packs() const noexcept
+    {
+        return this->_packs;
+    }
+
+    float & MatrixArena::at(const size_t m, const size_t r,
+                            const size_t c) noexcept
+    {
+        const auto & member = this->_members.at(m);
+        assert(r < member.rows && c < member.columns);
+        auto & pack = this->_packs.at(member.firstPack +
+                                      c * padSize(member.rows) +
+                                      r / NUM_FLOATS_PER_AVX_REGISTER);
+        return pack.at(r % NUM_FLOATS_PER_AVX_REGISTER);
+    }
+
+    float MatrixArena::at(const size_t m, const size_t r,
+                          const size_t c) const noexcept
+    {
+        const auto & member = this->_members.at(m);
+        assert(r < member.rows && c < member.columns);
+        const auto & pack = this->_packs.at(member.firstPack +
+                                            c * padSize(member.rows) +
+                                            r / NUM_FLOATS_PER_AVX_REGISTER);
+        return pack.at(r % NUM_FLOATS_PER_AVX_REGISTER);
+    }
+
+    void VectorArena::reserve(const size_t vectors, const size_t packs) noexcept
+    {
+        this->_members.reserve(vectors);
+        this->_packs.reserve(packs);
+    }
+
+    size_t VectorArena::add(const size_t elements,
+                            const float initialValue) noexcept
+    {
+        assert(elements > 0);
+
+        this->_members.push_back(Member{elements, this->_packs.size()});
+        appendPacks(this->_packs, elements, initialValue);
+        return this->_members.size() - 1;
+    }
+
+    size_t VectorArena::add(const AVXVector & vector) noexcept
+    {
+        this->_members.push_back(Member{vector.size(), this->_packs.size()});
+        this->_packs.insert(this->_packs.end(), vector.packs().cbegin(),
+                            vector.packs().cend());
+        return this->_members.size() - 1;
+    }
+
+    size_t VectorArena::size() const noexcept
+    {
+        return this->_members.size();
+    }
+
+    size_t VectorArena::elements(const size_t v) const noexcept
+    {
+        return this->_members.at(v).elements;
+    }
+
+    size_t VectorArena::firstPack(const size_t v) const noexcept
+    {
+        return this->_members.at(v).firstPack;
+    }
+
+    vector<AVXPack> & VectorArena::packs() noexcept
+    {
+        return this->_packs;
+    }
+
+    const vector<AVXPack> & VectorArena::packs() const noexcept
+    {
+        return this->_packs;
+    }
+
+    float & VectorArena::at(const size_t v, const size_t i) noexcept
+    {
+        const auto & member = this->_members.at(v);
+        assert(i < member.elements);
+        return this->_packs.at(member.firstPack +
+                               i / NUM_FLOATS_PER_AVX_REGISTER)
+            .at(i % NUM_FLOATS_PER_AVX_REGISTER);
+    }
+
+    float VectorArena::at(const size_t v, const size_t i) const noexcept
+    {
+        const auto & member = this->_members.at(v);
+        assert(i < member.elements);
+        return this->_packs.at(member.firstPack +
+                               i / NUM_FLOATS_PER_AVX_REGISTER)
+            .at(i % NUM_FLOATS_PER_AVX_REGISTER);
+    }
+
+    VectorArena resultArena(const MatrixArena & matrices) noexcept
+    {
+        VectorArena results;
+        size_t packs{0};
+        for (size_t m{0}; m < matrices.size(); ++m)
+        {
+            packs += padSize(matrices.rows(m));
+        }
+        results.reserve(matrices.size(), packs);
+
+        for (size_t m{0}; m < matrices.size(); ++m)
+        {
+            results.add(matrices.rows(m));
+        }
+        return results;
+    }
+}
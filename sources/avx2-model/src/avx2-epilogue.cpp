@@ -0,0 +1,23 @@
+#include "avx2-epilogue.h"
+
+#include <host-info.h>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    bool usesStreamingStores(const StoreMode storeMode,
+                             const size_t resultElements) noexcept
+    {
+        switch (storeMode)
+        {
+        case StoreMode::CACHED:
+            return false;
+        case StoreMode::STREAMING:
+            return true;
+        default:
+            return padSize(resultElements) * sizeof(AVXPack) >
+                   host::cacheSizes().l3;
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include "avx2-matrix-updates.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // All bits set in the lanes of the last pack of a column that hold
+        // rows instead of padding.
+        __m256 rowLanesMask(const size_t rows) noexcept
+        {
+            const auto rowLanes =
+                static_cast<int>(rows % NUM_FLOATS_PER_AVX_REGISTER);
+            const auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            return _mm256_castsi256_ps(
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(rowLanes), lanes));
+        }
+    }
+
+    void ger(SOAMatrix & matrix, const float alpha, const AVXVector & u,
+             const AVXVector & v) noexcept
+    {
+        ger(matrix, alpha, u, v, 0, matrix.columns());
+    }
+
+    void ger(SOAMatrix & matrix, const float alpha, const AVXVector & u,
+             const AVXVector & v, const size_t firstColumn,
+             const size_t lastColumn) noexcept
+    {
+        assert(u.size() == matrix.rows());
+        assert(v.size() == matrix.columns());
+        assert(firstColumn <= lastColumn && lastColumn <= matrix.columns());
+
+        const auto packsPerColumn = padSize(matrix.rows());
+        const auto & uPacks = u.packs();
+
+        // Without padding lanes, the last pack is updated like the others.
+        const auto paddedRows =
+            matrix.rows() % NUM_FLOATS_PER_AVX_REGISTER != 0;
+        const auto fullPacks = paddedRows ? packsPerColumn - 1 : packsPerColumn;
+        const auto rowLanes = rowLanesMask(matrix.rows());
+
+        for (auto c = firstColumn; c < lastColumn; ++c)
+        {
+            const auto scale = _mm256_set1_ps(alpha * v.at(c));
+            const auto column = matrix.packs().data() + c * packsPerColumn;
+
+            for (size_t p{0}; p < fullPacks; ++p)
+            {
+                const auto columnData = column[p].data();
+                _mm256_store_ps(
+                    columnData,
+                    _mm256_add_ps(
+                        _mm256_mul_ps(_mm256_load_ps(uPacks[p].data()), scale),
+                        _mm256_load_ps(columnData)));
+            }
+
+            if (paddedRows)
+            {
+                const auto columnData = column[fullPacks].data();
+                const auto original = _mm256_load_ps(columnData);
+                const auto updated = _mm256_add_ps(
+                    _mm256_mul_ps(_mm256_load_ps(uPacks[fullPacks].data()),
+                                  scale),
+                    original);
+                _mm256_store_ps(columnData,
+                                _mm256_blendv_ps(original, updated, rowLanes));
+            }
+        }
+    }
+
+    void replaceColumn(SOAMatrix & matrix, const size_t column,
+                       const AVXVector & values) noexcept
+    {
+        assert(values.size() == matrix.rows());
+        assert(column < matrix.columns());
+
+        // Vectors and matrices share the padding value, so that the padding
+        // is copied along.
+        const auto packsPerColumn = padSize(matrix.rows());
+        copy(values.packs().cbegin(), values.packs().cend(),
+             matrix.packs().begin() +
+                 static_cast<ptrdiff_t>(column * packsPerColumn));
+    }
+
+    void replaceRow(SOAMatrix & matrix, const size_t row,
+                    const AVXVector & values) noexcept
+    {
+        assert(values.size() == matrix.columns());
+        assert(row < matrix.rows());
+
+        // The row has one element in the same lane of the same pack of each
+        // column.
+        const auto packsPerColumn = padSize(matrix.rows());
+        const auto lane = row % NUM_FLOATS_PER_AVX_REGISTER;
+        auto pack = matrix.packs().data() + row / NUM_FLOATS_PER_AVX_REGISTER;
+
+        size_t c{0};
+        for (auto && valuesPack : values.packs())
+        {
+            for (size_t i{0};
+                 i < NUM_FLOATS_PER_AVX_REGISTER && c < matrix.columns();
+                 ++i, ++c)
+            {
+                (*pack)[lane] = valuesPack[i];
+                pack += packsPerColumn;
+            }
+        }
+    }
+}
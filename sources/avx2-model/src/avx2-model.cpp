@@ -51,6 +51,24 @@ namespace matrixmultiplication::avx2
         return this->_elements;
     }
 
+    void AVXVector::resize(const size_t elements) noexcept
+    {
+        assert(elements > 0);
+
+        AVXPack initialPack{};
+        initialPack.fill(INITIAL_VALUE);
+
+        this->_packs.resize(padSize(elements), initialPack);
+        this->_elements = elements;
+
+        const auto paddedElements =
+            this->_packs.size() * NUM_FLOATS_PER_AVX_REGISTER;
+        for (size_t i{elements}; i < paddedElements; ++i)
+        {
+            this->at(i) = PADDING_VALUE;
+        }
+    }
+
     float & AVXVector::at(const size_t i) noexcept
     {
         auto & pack = this->_packs.at(i / NUM_FLOATS_PER_AVX_REGISTER);
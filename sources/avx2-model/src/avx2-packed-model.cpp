@@ -0,0 +1,130 @@
+#include "avx2-packed-model.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        PackedBlocking resolve(const PackedBlocking & blocking,
+                               const size_t columns) noexcept
+        {
+            assert(blocking.rowPanelPacks > 0 &&
+                   blocking.rowPanelPacks <= PACKED_MAX_ROW_PANEL_PACKS);
+            assert(blocking.columnPanelColumns %
+                       NUM_FLOATS_PER_AVX_REGISTER ==
+                   0);
+
+            auto resolved = blocking;
+            if (resolved.columnPanelColumns == 0 ||
+                resolved.columnPanelColumns > columns)
+            {
+                resolved.columnPanelColumns =
+                    padSize(columns) * NUM_FLOATS_PER_AVX_REGISTER;
+            }
+            return resolved;
+        }
+    }
+
+    PackedMatrix::PackedMatrix(const SOAMatrix & matrix,
+                               const PackedBlocking & blocking) noexcept
+        : _rows(matrix.rows()), _columns(matrix.columns()),
+          _blocking(resolve(blocking, matrix.columns()))
+    {
+        const auto packsPerColumn = padSize(this->_rows);
+        const auto & source = matrix.packs();
+        this->_packs.reserve(source.size());
+
+        const auto panelColumns = this->_blocking.columnPanelColumns;
+        const auto panelPacks = this->_blocking.rowPanelPacks;
+        for (size_t cp{0}; cp < this->columnPanels(); ++cp)
+        {
+            const auto firstColumn = cp * panelColumns;
+            const auto lastColumn =
+                min(this->_columns, firstColumn + panelColumns);
+            for (size_t rp{0}; rp < this->rowPanels(); ++rp)
+            {
+                const auto firstPack = rp * panelPacks;
+                const auto lastPack =
+                    min(packsPerColumn, firstPack + panelPacks);
+                for (auto c = firstColumn; c < lastColumn; ++c)
+                {
+                    const auto column =
+                        source.cbegin() +
+                        static_cast<ptrdiff_t>(c * packsPerColumn);
+                    this->_packs.insert(
+                        this->_packs.end(),
+                        column + static_cast<ptrdiff_t>(firstPack),
+                        column + static_cast<ptrdiff_t>(lastPack));
+                }
+            }
+        }
+    }
+
+    size_t PackedMatrix::rows() const noexcept
+    {
+        return this->_rows;
+    }
+
+    size_t PackedMatrix::columns() const noexcept
+    {
+        return this->_columns;
+    }
+
+    const PackedBlocking & PackedMatrix::blocking() const noexcept
+    {
+        return this->_blocking;
+    }
+
+    size_t PackedMatrix::rowPanels() const noexcept
+    {
+        return (padSize(this->_rows) + this->_blocking.rowPanelPacks - 1) /
+               this->_blocking.rowPanelPacks;
+    }
+
+    size_t PackedMatrix::columnPanels() const noexcept
+    {
+        return (this->_columns + this->_blocking.columnPanelColumns - 1) /
+               this->_blocking.columnPanelColumns;
+    }
+
+    size_t PackedMatrix::firstPack(const size_t columnPanel,
+                                   const size_t rowPanel) const noexcept
+    {
+        // All column panels but the last one and all row panels but the
+        // last one are full.
+        const auto firstColumn =
+            columnPanel * this->_blocking.columnPanelColumns;
+        const auto panelColumns = min(this->_blocking.columnPanelColumns,
+                                      this->_columns - firstColumn);
+        return firstColumn * padSize(this->_rows) +
+               rowPanel * this->_blocking.rowPanelPacks * panelColumns;
+    }
+
+    const vector<AVXPack> & PackedMatrix::packs() const noexcept
+    {
+        return this->_packs;
+    }
+
+    float PackedMatrix::at(const size_t r, const size_t c) const noexcept
+    {
+        assert(r < this->_rows && c < this->_columns);
+
+        const auto columnPanel = c / this->_blocking.columnPanelColumns;
+        const auto rowPack = r / NUM_FLOATS_PER_AVX_REGISTER;
+        const auto rowPanel = rowPack / this->_blocking.rowPanelPacks;
+        const auto firstRowPack = rowPanel * this->_blocking.rowPanelPacks;
+        const auto rowPanelPacks = min(this->_blocking.rowPanelPacks,
+                                       padSize(this->_rows) - firstRowPack);
+        const auto panelColumn =
+            c - columnPanel * this->_blocking.columnPanelColumns;
+
+        const auto & pack = this->_packs.at(
+            this->firstPack(columnPanel, rowPanel) +
+            panelColumn * rowPanelPacks + rowPack - firstRowPack);
+        return pack[r % NUM_FLOATS_PER_AVX_REGISTER];
+    }
+}
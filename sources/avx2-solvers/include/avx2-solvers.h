@@ -0,0 +1,91 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::solvers
+{
+    struct SolverOptions
+    {
+        std::size_t maxIterations{1000};
+
+        // The solvers stop once their relative residual falls below it.
+        float tolerance{1e-5F};
+
+        // Whether the matrix-vector products run multi-threaded.
+        bool multiThreaded{false};
+    };
+
+    struct SolverResult
+    {
+        // Count of matrix-vector products.
+        std::size_t iterations;
+
+        float residual;
+        bool converged;
+    };
+
+    // Estimates the eigenvalue of the largest magnitude of a square matrix
+    // and its eigenvector. The workspace is allocated once for matrices of
+    // the given size, so that solving allocates nothing.
+    class PowerIteration
+    {
+        avx2::AVXVector _product;
+
+      public:
+        explicit PowerIteration(const std::size_t size) noexcept;
+
+        // Iterates from the given non-zero vector, which receives the
+        // normalized eigenvector. The residual is the change of the
+        // eigenvalue estimate in the last iteration relative to it.
+        SolverResult solve(const avx2::SOAMatrix & matrix,
+                           avx2::AVXVector & eigenvector, float & eigenvalue,
+                           const SolverOptions & options = {}) noexcept;
+    };
+
+    // Solves Ax = b for symmetric positive definite A by the conjugate
+    // gradient method. The workspace is allocated once for systems of the
+    // given size, so that solving allocates nothing.
+    class ConjugateGradient
+    {
+        avx2::AVXVector _residual;
+        avx2::AVXVector _direction;
+        avx2::AVXVector _product;
+
+      public:
+        explicit ConjugateGradient(const std::size_t size) noexcept;
+
+        // Iterates from the initial guess in the solution. The residual is
+        // |b - Ax| / |b|.
+        SolverResult solve(const avx2::SOAMatrix & matrix,
+                           const avx2::AVXVector & rightHandSide,
+                           avx2::AVXVector & solution,
+                           const SolverOptions & options = {}) noexcept;
+    };
+
+    // Solves Ax = b for square A by GMRES, which restarts after the given
+    // count of iterations to bound its workspace. The workspace is allocated
+    // once for systems of the given size, so that solving allocates nothing.
+    class RestartedGmres
+    {
+        std::size_t _restart;
+        std::vector<avx2::AVXVector> _basis;
+        std::vector<float> _hessenberg;
+        std::vector<float> _cosines;
+        std::vector<float> _sines;
+        std::vector<float> _rotatedResidual;
+
+      public:
+        explicit RestartedGmres(const std::size_t size,
+                                const std::size_t restart = 30) noexcept;
+
+        // Iterates from the initial guess in the solution. The residual is
+        // |b - Ax| / |b|.
+        SolverResult solve(const avx2::SOAMatrix & matrix,
+                           const avx2::AVXVector & rightHandSide,
+                           avx2::AVXVector & solution,
+                           const SolverOptions & options = {}) noexcept;
+    };
+}
@@ -0,0 +1,267 @@
+#include "avx2-solvers.h"
+
+#include <avx2-blas1.h>
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <cassert>
+#include <cmath>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+
+namespace matrixmultiplication::solvers
+{
+    namespace
+    {
+        // Computes the matrix-vector product into the preallocated result.
+        void multiply(const SOAMatrix & matrix, const AVXVector & input,
+                      AVXVector & result,
+                      const SolverOptions & options) noexcept
+        {
+            if (options.multiThreaded)
+            {
+                transformMultiThreaded(matrix, input, result);
+            }
+            else
+            {
+                transform(matrix, input, result);
+            }
+        }
+    }
+
+    PowerIteration::PowerIteration(const size_t size) noexcept
+        : _product(size)
+    {
+    }
+
+    SolverResult PowerIteration::solve(const SOAMatrix & matrix,
+                                       AVXVector & eigenvector,
+                                       float & eigenvalue,
+                                       const SolverOptions & options) noexcept
+    {
+        assert(matrix.rows() == matrix.columns());
+        assert(eigenvector.size() == matrix.columns());
+        assert(this->_product.size() == matrix.rows());
+
+        const auto initialNorm = norm(eigenvector);
+        assert(initialNorm > 0.0F);
+        scale(1.0F / initialNorm, eigenvector);
+
+        SolverResult result{0, INFINITY, false};
+        eigenvalue = 0.0F;
+        while (result.iterations < options.maxIterations && !result.converged)
+        {
+            multiply(matrix, eigenvector, this->_product, options);
+            ++result.iterations;
+
+            // The Rayleigh quotient of the normalized vector and the norm of
+            // the product, which normalizes the next vector, in one pass.
+            const auto [rayleighQuotient, squaredNorm] =
+                dotAndSquaredNorm(eigenvector, this->_product);
+            if (squaredNorm == 0.0F)
+            {
+                // The vector lies in the null space of the matrix.
+                eigenvalue = 0.0F;
+                result.residual = 0.0F;
+                result.converged = true;
+                break;
+            }
+
+            result.residual = abs(rayleighQuotient - eigenvalue) /
+                              abs(rayleighQuotient);
+            result.converged = result.residual < options.tolerance;
+            eigenvalue = rayleighQuotient;
+
+            swap(eigenvector, this->_product);
+            scale(1.0F / sqrt(squaredNorm), eigenvector);
+        }
+        return result;
+    }
+
+    ConjugateGradient::ConjugateGradient(const size_t size) noexcept
+        : _residual(size), _direction(size), _product(size)
+    {
+    }
+
+    SolverResult ConjugateGradient::solve(
+        const SOAMatrix & matrix, const AVXVector & rightHandSide,
+        AVXVector & solution, const SolverOptions & options) noexcept
+    {
+        assert(matrix.rows() == matrix.columns());
+        assert(rightHandSide.size() == matrix.rows());
+        assert(solution.size() == matrix.columns());
+        assert(this->_residual.size() == matrix.rows());
+
+        auto & residual = this->_residual;
+        auto & direction = this->_direction;
+        auto & product = this->_product;
+
+        SolverResult result{0, 0.0F, true};
+        const auto rightHandSideNorm = norm(rightHandSide);
+        if (rightHandSideNorm == 0.0F)
+        {
+            // The solution of a homogeneous system is zero.
+            scale(0.0F, solution);
+            return result;
+        }
+
+        // r = b - Ax, p = r
+        multiply(matrix, solution, residual, options);
+        auto squaredResidualNorm =
+            axpbyAndSquaredNorm(1.0F, rightHandSide, -1.0F, residual);
+        direction = residual;
+
+        result.residual = sqrt(squaredResidualNorm) / rightHandSideNorm;
+        result.converged = result.residual < options.tolerance;
+        while (result.iterations < options.maxIterations && !result.converged)
+        {
+            multiply(matrix, direction, product, options);
+            ++result.iterations;
+
+            const auto curvature = dot(direction, product);
+            if (curvature <= 0.0F)
+            {
+                // The matrix is not positive definite along the direction.
+                break;
+            }
+            const auto alpha = squaredResidualNorm / curvature;
+
+            // x += alpha * p, r -= alpha * Ap fused with the new |r|^2
+            axpy(alpha, direction, solution);
+            const auto nextSquaredResidualNorm =
+                axpbyAndSquaredNorm(-alpha, product, 1.0F, residual);
+
+            result.residual =
+                sqrt(nextSquaredResidualNorm) / rightHandSideNorm;
+            result.converged = result.residual < options.tolerance;
+
+            // p = r + beta * p
+            axpby(1.0F, residual,
+                  nextSquaredResidualNorm / squaredResidualNorm, direction);
+            squaredResidualNorm = nextSquaredResidualNorm;
+        }
+        return result;
+    }
+
+    RestartedGmres::RestartedGmres(const size_t size,
+                                   const size_t restart) noexcept
+        : _restart(restart), _basis(restart + 1, AVXVector(size)),
+          _hessenberg((restart + 1) * restart), _cosines(restart),
+          _sines(restart), _rotatedResidual(restart + 1)
+    {
+        assert(restart > 0);
+    }
+
+    SolverResult RestartedGmres::solve(const SOAMatrix & matrix,
+                                       const AVXVector & rightHandSide,
+                                       AVXVector & solution,
+                                       const SolverOptions & options) noexcept
+    {
+        assert(matrix.rows() == matrix.columns());
+        assert(rightHandSide.size() == matrix.rows());
+        assert(solution.size() == matrix.columns());
+        assert(this->_basis.front().size() == matrix.rows());
+
+        const auto restart = this->_restart;
+        auto & basis = this->_basis;
+        auto & g = this->_rotatedResidual;
+
+        // The Hessenberg matrix is stored column-major.
+        const auto h = [&](const size_t row, const size_t column) -> float & {
+            return this->_hessenberg[column * (restart + 1) + row];
+        };
+
+        SolverResult result{0, 0.0F, true};
+        const auto rightHandSideNorm = norm(rightHandSide);
+        if (rightHandSideNorm == 0.0F)
+        {
+            // The solution of a homogeneous system is zero.
+            scale(0.0F, solution);
+            return result;
+        }
+
+        result.converged = false;
+        while (!result.converged)
+        {
+            // r = b - Ax, which starts the Krylov basis.
+            multiply(matrix, solution, basis[0], options);
+            const auto residualNorm =
+                sqrt(axpbyAndSquaredNorm(1.0F, rightHandSide, -1.0F,
+                                         basis[0]));
+            result.residual = residualNorm / rightHandSideNorm;
+            result.converged = result.residual < options.tolerance;
+            if (result.converged || result.iterations >= options.maxIterations)
+            {
+                break;
+            }
+
+            scale(1.0F / residualNorm, basis[0]);
+            fill(g.begin(), g.end(), 0.0F);
+            g[0] = residualNorm;
+
+            size_t steps{0};
+            while (steps < restart && result.iterations < options.maxIterations)
+            {
+                const auto j = steps;
+                auto & next = basis[j + 1];
+                multiply(matrix, basis[j], next, options);
+                ++result.iterations;
+                ++steps;
+
+                // Modified Gram-Schmidt, with the norm of the orthogonalized
+                // vector fused into its last update.
+                float nextSquaredNorm{0.0F};
+                for (size_t i{0}; i <= j; ++i)
+                {
+                    h(i, j) = dot(next, basis[i]);
+                    nextSquaredNorm =
+                        axpbyAndSquaredNorm(-h(i, j), basis[i], 1.0F, next);
+                }
+                h(j + 1, j) = sqrt(nextSquaredNorm);
+
+                // Applies the previous Givens rotations to the new column and
+                // computes the one that eliminates its subdiagonal element.
+                for (size_t i{0}; i < j; ++i)
+                {
+                    const auto upper = h(i, j);
+                    const auto lower = h(i + 1, j);
+                    h(i, j) = this->_cosines[i] * upper +
+                              this->_sines[i] * lower;
+                    h(i + 1, j) = -this->_sines[i] * upper +
+                                  this->_cosines[i] * lower;
+                }
+                const auto radius = hypot(h(j, j), h(j + 1, j));
+                this->_cosines[j] = h(j, j) / radius;
+                this->_sines[j] = h(j + 1, j) / radius;
+                h(j, j) = radius;
+                g[j + 1] = -this->_sines[j] * g[j];
+                g[j] = this->_cosines[j] * g[j];
+
+                // The rotated residual estimates |b - Ax| without computing
+                // x. A zero subdiagonal element means the exact solution
+                // lies in the Krylov space.
+                const auto breakdown = h(j + 1, j) == 0.0F;
+                if (abs(g[j + 1]) / rightHandSideNorm < options.tolerance ||
+                    breakdown)
+                {
+                    break;
+                }
+                scale(1.0F / h(j + 1, j), next);
+            }
+
+            // Solves the triangular least-squares system in place of g and
+            // adds the combination of the basis to the solution.
+            for (auto i = steps; i-- > 0;)
+            {
+                for (auto k = i + 1; k < steps; ++k)
+                {
+                    g[i] -= h(i, k) * g[k];
+                }
+                g[i] /= h(i, i);
+                axpy(g[i], basis[i], solution);
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "avx2-generator.h"
+
+#include <avx2-model.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // An in-process, socket-like source of float chunks of any size, which
+    // one thread writes and another one reads.
+    class ChunkChannel
+    {
+        std::deque<std::vector<float>> _chunks;
+        bool _closed{false};
+        std::mutex _mutex;
+        std::condition_variable _written;
+
+      public:
+        void write(std::vector<float> chunk) noexcept;
+
+        // Ends the stream after the written chunks.
+        void close() noexcept;
+
+        // Blocks until a chunk arrives, and returns nothing at the end of
+        // the stream.
+        std::optional<std::vector<float>> read() noexcept;
+    };
+
+    // Reassembles the chunks of the channel into the packs of an input
+    // vector with the given count of elements, and yields each pack as soon
+    // as it is complete. The last pack is padded.
+    Generator<AVXPack> packsOf(ChunkChannel & channel,
+                               const std::size_t size) noexcept;
+}
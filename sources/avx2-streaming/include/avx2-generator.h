@@ -0,0 +1,124 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace matrixmultiplication::avx2
+{
+    // A lazy sequence of values produced by a coroutine with co_yield, until
+    // std::generator of C++23 is available. Each value is produced when the
+    // consumer advances to it, so that the producer may wait for its data
+    // in between.
+    template <typename T> class Generator
+    {
+      public:
+        struct promise_type
+        {
+            const T * current{nullptr};
+
+            Generator get_return_object() noexcept
+            {
+                return Generator{Handle::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            // The value lives in the coroutine frame while it is suspended.
+            std::suspend_always yield_value(const T & value) noexcept
+            {
+                this->current = std::addressof(value);
+                return {};
+            }
+
+            void return_void() const noexcept
+            {
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                std::terminate();
+            }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        class Iterator
+        {
+            Handle _coroutine;
+
+          public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            explicit Iterator(const Handle coroutine) noexcept
+                : _coroutine(coroutine)
+            {
+            }
+
+            const T & operator*() const noexcept
+            {
+                return *this->_coroutine.promise().current;
+            }
+
+            Iterator & operator++() noexcept
+            {
+                this->_coroutine.resume();
+                return *this;
+            }
+
+            bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return this->_coroutine.done();
+            }
+        };
+
+        explicit Generator(const Handle coroutine) noexcept
+            : _coroutine(coroutine)
+        {
+        }
+
+        Generator(Generator && other) noexcept
+            : _coroutine(std::exchange(other._coroutine, nullptr))
+        {
+        }
+
+        Generator(const Generator &) = delete;
+        Generator & operator=(const Generator &) = delete;
+        Generator & operator=(Generator &&) = delete;
+
+        ~Generator() noexcept
+        {
+            if (this->_coroutine)
+            {
+                this->_coroutine.destroy();
+            }
+        }
+
+        // Runs the coroutine up to its first value.
+        Iterator begin() noexcept
+        {
+            this->_coroutine.resume();
+            return Iterator{this->_coroutine};
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+      private:
+        Handle _coroutine;
+    };
+}
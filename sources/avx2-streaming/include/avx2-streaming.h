@@ -0,0 +1,40 @@
+#pragma once
+
+#include "avx2-generator.h"
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <optional>
+
+namespace matrixmultiplication::avx2
+{
+    // Transforms an input vector that arrives pack by pack. Thanks to the
+    // SOA layout, each input pack only touches its 8 matrix columns, so that
+    // it is accumulated into the result as soon as it arrives, and the
+    // result is complete right after the last pack.
+    class StreamingTransform
+    {
+        const SOAMatrix & _matrix;
+        AVXVector _result;
+        std::size_t _nextColumn{0};
+
+      public:
+        explicit StreamingTransform(const SOAMatrix & matrix) noexcept;
+
+        // Accumulates the columns of the next input pack.
+        void consume(const AVXPack & inputPack) noexcept;
+
+        bool complete() const noexcept;
+
+        // The partial result until the transformation is complete.
+        const AVXVector & result() const noexcept;
+    };
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication with the
+    // input packs drawn from the generator while they are produced. Returns
+    // nothing if the generator ends before the packs of all C columns, e.g.
+    // because the producer closed its channel early, or yields more packs.
+    std::optional<AVXVector> transformStream(
+        const SOAMatrix & matrix, Generator<AVXPack> inputPacks) noexcept;
+}
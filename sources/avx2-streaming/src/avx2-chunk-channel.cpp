@@ -0,0 +1,86 @@
+#include "avx2-chunk-channel.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    void ChunkChannel::write(vector<float> chunk) noexcept
+    {
+        {
+            lock_guard<mutex> lock{this->_mutex};
+            this->_chunks.push_back(move(chunk));
+        }
+        this->_written.notify_one();
+    }
+
+    void ChunkChannel::close() noexcept
+    {
+        {
+            lock_guard<mutex> lock{this->_mutex};
+            this->_closed = true;
+        }
+        this->_written.notify_all();
+    }
+
+    optional<vector<float>> ChunkChannel::read() noexcept
+    {
+        unique_lock<mutex> lock{this->_mutex};
+        this->_written.wait(
+            lock, [this]() { return !this->_chunks.empty() || this->_closed; });
+        if (this->_chunks.empty())
+        {
+            return nullopt;
+        }
+
+        auto chunk = move(this->_chunks.front());
+        this->_chunks.pop_front();
+        return chunk;
+    }
+
+    Generator<AVXPack> packsOf(ChunkChannel & channel,
+                               const size_t size) noexcept
+    {
+        // The coroutine frame does not keep the alignment of its locals, so
+        // that the pack is allocated separately.
+        const auto pack = make_unique<AVXPack>();
+        pack->fill(PADDING_VALUE);
+
+        size_t received{0};
+        while (received < size)
+        {
+            const auto chunk = channel.read();
+            if (!chunk)
+            {
+                break;
+            }
+
+            for (auto value : *chunk)
+            {
+                if (received == size)
+                {
+                    break;
+                }
+
+                (*pack)[received % NUM_FLOATS_PER_AVX_REGISTER] = value;
+                ++received;
+
+                if (received % NUM_FLOATS_PER_AVX_REGISTER == 0)
+                {
+                    co_yield *pack;
+                }
+            }
+        }
+
+        if (received % NUM_FLOATS_PER_AVX_REGISTER != 0)
+        {
+            for (auto i = received % NUM_FLOATS_PER_AVX_REGISTER;
+                 i < NUM_FLOATS_PER_AVX_REGISTER; ++i)
+            {
+                (*pack)[i] = PADDING_VALUE;
+            }
+            co_yield *pack;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include "avx2-streaming.h"
+
+#include <avx2-epilogue.h>
+#include <avx2-variant.h>
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    StreamingTransform::StreamingTransform(const SOAMatrix & matrix) noexcept
+        : _matrix(matrix), _result(matrix.rows(), 0.0F)
+    {
+        assert(matrix.rows() > 0);
+    }
+
+    void StreamingTransform::consume(const AVXPack & inputPack) noexcept
+    {
+        assert(!this->complete());
+
+        accumulateColumns(this->_matrix, inputPack, this->_nextColumn,
+                          this->_result);
+        this->_nextColumn =
+            min(this->_nextColumn + NUM_FLOATS_PER_AVX_REGISTER,
+                this->_matrix.columns());
+        if (this->complete())
+        {
+            restorePadding(this->_result);
+        }
+    }
+
+    bool StreamingTransform::complete() const noexcept
+    {
+        return this->_nextColumn == this->_matrix.columns();
+    }
+
+    const AVXVector & StreamingTransform::result() const noexcept
+    {
+        return this->_result;
+    }
+
+    optional<AVXVector> transformStream(
+        const SOAMatrix & matrix, Generator<AVXPack> inputPacks) noexcept
+    {
+        StreamingTransform streamingTransform{matrix};
+        for (auto && inputPack : inputPacks)
+        {
+            if (streamingTransform.complete())
+            {
+                return nullopt;
+            }
+            streamingTransform.consume(inputPack);
+        }
+
+        if (!streamingTransform.complete())
+        {
+            return nullopt;
+        }
+        return streamingTransform.result();
+    }
+}
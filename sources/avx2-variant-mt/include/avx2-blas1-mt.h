@@ -0,0 +1,53 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <utility>
+
+// The level-1 operations of avx2-blas1.h with the packs split among the
+// OpenMP threads. The reductions give the same results as the
+// single-threaded ones for any count of threads, as the threads compute the
+// partial sums of whole reduction blocks, which are then added in their
+// order by one thread.
+namespace matrixmultiplication::avx2
+{
+    // Returns x . y.
+    float dotMultiThreaded(const AVXVector & x, const AVXVector & y) noexcept;
+
+    // Returns x . x.
+    float squaredNormMultiThreaded(const AVXVector & x) noexcept;
+
+    // Returns the Euclidean norm of x.
+    float normMultiThreaded(const AVXVector & x) noexcept;
+
+    // Returns x . y and y . y in one pass.
+    std::pair<float, float> dotAndSquaredNormMultiThreaded(
+        const AVXVector & x, const AVXVector & y) noexcept;
+
+    // Computes x *= alpha.
+    void scaleMultiThreaded(const float alpha, AVXVector & x) noexcept;
+
+    // Computes y += alpha * x.
+    void axpyMultiThreaded(const float alpha, const AVXVector & x,
+                           AVXVector & y) noexcept;
+
+    // Computes y = alpha * x + beta * y.
+    void axpbyMultiThreaded(const float alpha, const AVXVector & x,
+                            const float beta, AVXVector & y) noexcept;
+
+    // Computes y = alpha * x + beta * y and returns the new y . y in the
+    // same pass.
+    float axpbyAndSquaredNormMultiThreaded(const float alpha,
+                                           const AVXVector & x,
+                                           const float beta,
+                                           AVXVector & y) noexcept;
+
+    // Computes result = x + y element-wise.
+    void addMultiThreaded(const AVXVector & x, const AVXVector & y,
+                          AVXVector & result) noexcept;
+
+    // Computes result = x * y element-wise.
+    void multiplyElementwiseMultiThreaded(const AVXVector & x,
+                                          const AVXVector & y,
+                                          AVXVector & result) noexcept;
+}
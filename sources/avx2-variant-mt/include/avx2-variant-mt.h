@@ -1,11 +1,112 @@
 #pragma once
 
+#include <avx2-arena.h>
+#include <avx2-matrix-updates.h>
 #include <avx2-model.h>
+#include <avx2-packed-model.h>
+#include <avx2-transform-options.h>
+
+#include <cstddef>
 
 namespace matrixmultiplication::avx2
 {
+    // Of avx2-plan.h of the avx2-variant, which creates the plans.
+    class TransformPlan;
+
     // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication multi-threaded.
-    // Uses OpenMP to parallelize the outer-loop iterations.
+    // Splits the rows into panels, which the OpenMP threads balance through
+    // work-stealing. Each result element is computed by one thread in the
+    // order of the columns, so that the result does not depend on the count
+    // of threads.
     AVXVector transformMultiThreaded(const SOAMatrix & matrix,
                                      const AVXVector & inputVector) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication multi-threaded
+    // with the epilogue of the options applied to the last column of each
+    // panel, which stores the result packs according to the store mode of
+    // the options.
+    AVXVector transformMultiThreaded(const SOAMatrix & matrix,
+                                     const AVXVector & inputVector,
+                                     const TransformOptions & options) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication multi-threaded
+    // into the given result of R elements, which spares iterative loops the
+    // allocation of a result per call.
+    void transformMultiThreaded(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                AVXVector & resultVector) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication multi-threaded
+    // with the options into the given result of R elements.
+    void transformMultiThreaded(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                const TransformOptions & options,
+                                AVXVector & resultVector) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication multi-threaded
+    // with the columns split among the threads, which suits matrices with
+    // too few rows to give each thread row panels of its own. Each thread
+    // computes partial results over its columns, which are added according
+    // to the reduction mode of the options.
+    AVXVector transformSplitColumnsMultiThreaded(
+        const SOAMatrix & matrix, const AVXVector & inputVector) noexcept;
+
+    AVXVector transformSplitColumnsMultiThreaded(
+        const SOAMatrix & matrix, const AVXVector & inputVector,
+        const TransformOptions & options) noexcept;
+
+    // Like transformSplitColumnsMultiThreaded, but into the given result of
+    // R elements.
+    void transformSplitColumnsMultiThreaded(const SOAMatrix & matrix,
+                                            const AVXVector & inputVector,
+                                            const TransformOptions & options,
+                                            AVXVector & resultVector) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication by a matrix
+    // repacked into kernel order multi-threaded. Each OpenMP thread takes
+    // one contiguous range of the row panels, which it reads as one stream
+    // per column panel.
+    AVXVector transformPackedMultiThreaded(
+        const PackedMatrix & matrix, const AVXVector & inputVector) noexcept;
+
+    // Like transformPackedMultiThreaded, but into the given result of R
+    // elements.
+    void transformPackedMultiThreaded(const PackedMatrix & matrix,
+                                      const AVXVector & inputVector,
+                                      AVXVector & resultVector) noexcept;
+
+    // Like transformPackedMultiThreaded, but with the given count of OpenMP
+    // threads instead of the default one.
+    void transformPackedMultiThreaded(const PackedMatrix & matrix,
+                                      const AVXVector & inputVector,
+                                      AVXVector & resultVector,
+                                      const std::size_t threads) noexcept;
+
+    // Performs the rank-1 update A += alpha * u * v^T multi-threaded, with
+    // the columns split among the OpenMP threads.
+    void gerMultiThreaded(SOAMatrix & matrix, const float alpha,
+                          const AVXVector & u, const AVXVector & v) noexcept;
+
+    // Performs a MxK * KxN -> MxN matrix-matrix multiplication multi-threaded.
+    // The OpenMP threads pack each panel of B once together and share it,
+    // and split the blocks of A and the column tiles of the panel among
+    // them.
+    SOAMatrix multiplyMultiThreaded(const SOAMatrix & a,
+                                    const SOAMatrix & b) noexcept;
+
+    // Performs the matrix-vector multiplications of the pairs of matrices
+    // and input vectors in the arenas into the results multi-threaded. Each
+    // OpenMP thread takes one contiguous chunk of the pairs, which holds
+    // about the same count of matrix packs as the other chunks.
+    void transformArenaMultiThreaded(const MatrixArena & matrices,
+                                     const VectorArena & inputs,
+                                     VectorArena & results) noexcept;
+
+    // Executes the plan with as many OpenMP threads as it was created for.
+    // Each thread runs the segments the plan bound to it, so that the split
+    // is not decided again per call.
+    void executeMultiThreaded(const TransformPlan & plan,
+                              const SOAMatrix & matrix,
+                              const AVXVector & inputVector,
+                              AVXVector & result) noexcept;
 }
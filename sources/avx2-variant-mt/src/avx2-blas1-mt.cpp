@@ -0,0 +1,128 @@
+#include "avx2-blas1-mt.h"
+
+#include <avx2-blas1.h>
+#include <avx2-epilogue.h>
+
+#include <cmath>
+#include <vector>
+
+#include <omp.h>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // Calls the operation with one contiguous range of [0, count) per
+        // OpenMP thread. The elements cost the same, so that a static split
+        // balances them.
+        template <typename RangeOperation>
+        inline void forEachThreadRange(const size_t count,
+                                       RangeOperation && operation) noexcept
+        {
+#pragma omp parallel
+            {
+                const auto threads = static_cast<size_t>(omp_get_num_threads());
+                const auto thread = static_cast<size_t>(omp_get_thread_num());
+                operation(count * thread / threads,
+                          count * (thread + 1) / threads);
+            }
+        }
+    }
+
+    float dotMultiThreaded(const AVXVector & x, const AVXVector & y) noexcept
+    {
+        const auto blocks = reductionBlocks(x);
+        vector<AVXPack> partials(blocks);
+        forEachThreadRange(blocks, [&](const size_t first, const size_t last) {
+            dot(x, y, first, last, partials.data());
+        });
+        return sumPartials(partials.data(), blocks);
+    }
+
+    float squaredNormMultiThreaded(const AVXVector & x) noexcept
+    {
+        return dotMultiThreaded(x, x);
+    }
+
+    float normMultiThreaded(const AVXVector & x) noexcept
+    {
+        return sqrt(squaredNormMultiThreaded(x));
+    }
+
+    pair<float, float> dotAndSquaredNormMultiThreaded(
+        const AVXVector & x, const AVXVector & y) noexcept
+    {
+        const auto blocks = reductionBlocks(x);
+        vector<AVXPack> dotPartials(blocks);
+        vector<AVXPack> squaredNormPartials(blocks);
+        forEachThreadRange(blocks, [&](const size_t first, const size_t last) {
+            dotAndSquaredNorm(x, y, first, last, dotPartials.data(),
+                              squaredNormPartials.data());
+        });
+        return {sumPartials(dotPartials.data(), blocks),
+                sumPartials(squaredNormPartials.data(), blocks)};
+    }
+
+    void scaleMultiThreaded(const float alpha, AVXVector & x) noexcept
+    {
+        forEachThreadRange(x.packs().size(),
+                           [&](const size_t first, const size_t last) {
+                               scale(alpha, x, first, last);
+                           });
+        restorePadding(x);
+    }
+
+    void axpyMultiThreaded(const float alpha, const AVXVector & x,
+                           AVXVector & y) noexcept
+    {
+        axpbyMultiThreaded(alpha, x, 1.0F, y);
+    }
+
+    void axpbyMultiThreaded(const float alpha, const AVXVector & x,
+                            const float beta, AVXVector & y) noexcept
+    {
+        forEachThreadRange(y.packs().size(),
+                           [&](const size_t first, const size_t last) {
+                               axpby(alpha, x, beta, y, first, last);
+                           });
+        restorePadding(y);
+    }
+
+    float axpbyAndSquaredNormMultiThreaded(const float alpha,
+                                           const AVXVector & x,
+                                           const float beta,
+                                           AVXVector & y) noexcept
+    {
+        const auto blocks = reductionBlocks(y);
+        vector<AVXPack> partials(blocks);
+        forEachThreadRange(blocks, [&](const size_t first, const size_t last) {
+            axpbyAndSquaredNorm(alpha, x, beta, y, first, last,
+                                partials.data());
+        });
+        restorePadding(y);
+        return sumPartials(partials.data(), blocks);
+    }
+
+    void addMultiThreaded(const AVXVector & x, const AVXVector & y,
+                          AVXVector & result) noexcept
+    {
+        forEachThreadRange(result.packs().size(),
+                           [&](const size_t first, const size_t last) {
+                               add(x, y, result, first, last);
+                           });
+        restorePadding(result);
+    }
+
+    void multiplyElementwiseMultiThreaded(const AVXVector & x,
+                                          const AVXVector & y,
+                                          AVXVector & result) noexcept
+    {
+        forEachThreadRange(result.packs().size(),
+                           [&](const size_t first, const size_t last) {
+                               multiplyElementwise(x, y, result, first, last);
+                           });
+        restorePadding(result);
+    }
+}
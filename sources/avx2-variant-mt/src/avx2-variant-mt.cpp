@@ -1,6 +1,18 @@
 #include "avx2-variant-mt.h"
 
+#include <avx2-arena-transform.h>
+#include <avx2-gemm.h>
+#include <avx2-packed.h>
+#include <avx2-plan.h>
+#include <tracing.h>
+#include <work-stealing.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <omp.h>
 
 #if defined(__GNUC__)
 #include <x86intrin.h>
@@ -12,121 +24,584 @@ using namespace std;
 
 namespace matrixmultiplication::avx2
 {
-    auto broadcast(const __m256 & value, const int component) noexcept
+    namespace
     {
-        const auto componentMask = _mm256_set1_epi32(component);
-        return _mm256_permutevar8x32_ps(value, componentMask);
-    }
+        // Allocates the result of the returning overloads as a traced
+        // phase, as first touching its pages may fault.
+        AVXVector allocateResult(const size_t rows) noexcept
+        {
+            const tracing::PhaseScope allocation{tracing::Phase::ALLOCATION};
+            return AVXVector{rows};
+        }
 
-    // Similar to the TransformOperation of the single-threaded avx2-variant,
-    // this TransformOperation helps to split the code of the outer loop of
-    // the matrix-vector transformation.
-    class TransformOperation
-    {
-        size_t _rows;
-        size_t packsPerColumn;
-        vector<AVXPack>::const_iterator _dataStart;
+        // Enough panels per thread for balancing them dynamically.
+        constexpr size_t PANELS_PER_THREAD{4};
+
+        // Bounds the result packs of a panel, so that they stay in the L1
+        // cache while the panel sweeps all columns.
+        constexpr size_t MAX_PANEL_PACKS{128};
 
-      public:
-        TransformOperation(
-            const size_t rows,
-            const vector<AVXPack>::const_iterator dataStart) noexcept
-            : _rows(rows), packsPerColumn(padSize(rows)), _dataStart(dataStart)
+        auto broadcast(const __m256 & value, const int component) noexcept
         {
-            assert(rows > 0);
+            const auto componentMask = _mm256_set1_epi32(component);
+            return _mm256_permutevar8x32_ps(value, componentMask);
         }
 
-        AVXVector operator()(const size_t column,
-                             const __m256 & inputBroadcast) const noexcept
-        {
-            AVXVector resultVector{_rows, 0.0F};
+        // The reproducible split of the columns gives each chunk at least
+        // this many columns, so that the partial results cost little
+        // compared to the matrix data of a chunk.
+        constexpr size_t MIN_CHUNK_COLUMNS{256};
 
-            auto rowIt = this->_dataStart +
-                         static_cast<int64_t>(column * this->packsPerColumn);
+        // Bounds the partial results of the reproducible split of the
+        // columns.
+        constexpr size_t MAX_CHUNKS{64};
 
-            for (auto && resultPack : resultVector.packs())
+        // Accumulates the columns [firstColumn, lastColumn) times the input
+        // onto the partial result. The columns are swept in order, so that
+        // the partial result does not depend on the thread computing it.
+        void accumulateColumns(const SOAMatrix & matrix,
+                               const AVXVector & inputVector,
+                               const size_t firstColumn,
+                               const size_t lastColumn,
+                               AVXPack * partialResult) noexcept
+        {
+            const auto packsPerColumn = padSize(matrix.rows());
+            const auto inputPacks = inputVector.packs().data();
+            for (auto c = firstColumn; c < lastColumn; ++c)
             {
-                const auto partialColumn = _mm256_load_ps(rowIt->data());
-                const auto intermediate =
-                    _mm256_mul_ps(partialColumn, inputBroadcast);
-                _mm256_store_ps(resultPack.data(), intermediate);
+                const auto inputBroadcast = _mm256_set1_ps(
+                    inputPacks[c / NUM_FLOATS_PER_AVX_REGISTER]
+                              [c % NUM_FLOATS_PER_AVX_REGISTER]);
+                const auto column = matrix.packs().data() + c * packsPerColumn;
+                for (size_t p{0}; p < packsPerColumn; ++p)
+                {
+                    const auto resultData = partialResult[p].data();
+                    _mm256_store_ps(
+                        resultData,
+                        _mm256_add_ps(
+                            _mm256_mul_ps(_mm256_load_ps(column[p].data()),
+                                          inputBroadcast),
+                            _mm256_load_ps(resultData)));
+                }
+            }
+        }
 
-                ++rowIt;
+        // Adds the partial result onto the result.
+        void addPartialResult(const AVXPack * partialResult,
+                              AVXPack * result,
+                              const size_t packs) noexcept
+        {
+            for (size_t p{0}; p < packs; ++p)
+            {
+                _mm256_store_ps(
+                    result[p].data(),
+                    _mm256_add_ps(_mm256_load_ps(result[p].data()),
+                                  _mm256_load_ps(partialResult[p].data())));
             }
+        }
+
+        // Each thread accumulates one contiguous range of the columns and
+        // adds it to the result in the order the threads finish.
+        void transformSplitColumnsFast(const SOAMatrix & matrix,
+                                       const AVXVector & inputVector,
+                                       AVXVector & resultVector) noexcept
+        {
+            const auto packs = resultVector.packs().size();
+            const auto columns = matrix.columns();
+
+#pragma omp parallel
+            {
+                const auto threads = static_cast<size_t>(omp_get_num_threads());
+                const auto thread = static_cast<size_t>(omp_get_thread_num());
+                vector<AVXPack> partialResult;
+                {
+                    const tracing::PhaseScope allocation{
+                        tracing::Phase::ALLOCATION};
+                    partialResult.assign(packs, AVXPack{});
+                }
+                {
+                    const tracing::PhaseScope compute{
+                        tracing::Phase::COMPUTE};
+                    accumulateColumns(matrix, inputVector,
+                                      columns * thread / threads,
+                                      columns * (thread + 1) / threads,
+                                      partialResult.data());
+                }
 
-            return resultVector;
+                // The merge includes waiting for the lock, so that it shows
+                // the contention.
+                const tracing::PhaseScope merge{tracing::Phase::MERGE};
+#pragma omp critical
+                addPartialResult(partialResult.data(),
+                                 resultVector.packs().data(), packs);
+            }
         }
-    };
 
-    void mergeIntermediateIntoResult(const AVXVector & intermediateVector,
-                                     AVXVector & resultVector) noexcept
-    {
-        auto intermediateIt = intermediateVector.packs().cbegin();
-        for (auto && resultPack : resultVector.packs())
+        // The chunks depend on the shape only. Their partial results are
+        // added pairwise with doubling strides, each level of the tree
+        // split among the threads.
+        void transformSplitColumnsReproducible(
+            const SOAMatrix & matrix, const AVXVector & inputVector,
+            AVXVector & resultVector) noexcept
         {
-            const auto resultData = resultPack.data();
-            const auto productPack = _mm256_load_ps(intermediateIt->data());
-            const auto sumPack =
-                _mm256_add_ps(_mm256_load_ps(resultData), productPack);
-            _mm256_store_ps(resultData, sumPack);
+            const auto packs = resultVector.packs().size();
+            const auto columns = matrix.columns();
+            const auto chunks = clamp(columns / MIN_CHUNK_COLUMNS, size_t{1},
+                                      MAX_CHUNKS);
+
+            vector<AVXPack> partialResults;
+            {
+                const tracing::PhaseScope allocation{
+                    tracing::Phase::ALLOCATION};
+                partialResults.assign(chunks * packs, AVXPack{});
+            }
+            const auto partialResult = [&](const size_t chunk) {
+                return partialResults.data() + chunk * packs;
+            };
+
+#pragma omp parallel
+            {
+#pragma omp for schedule(static)
+                for (size_t chunk = 0; chunk < chunks; ++chunk)
+                {
+                    const tracing::PhaseScope compute{
+                        tracing::Phase::COMPUTE};
+                    accumulateColumns(matrix, inputVector,
+                                      columns * chunk / chunks,
+                                      columns * (chunk + 1) / chunks,
+                                      partialResult(chunk));
+                }
+
+                // The merge includes the barriers between the levels.
+                const tracing::PhaseScope merge{tracing::Phase::MERGE};
+                for (size_t stride{1}; stride < chunks; stride *= 2)
+                {
+#pragma omp for schedule(static)
+                    for (size_t chunk = 0; chunk < chunks - stride;
+                         chunk += 2 * stride)
+                    {
+                        addPartialResult(partialResult(chunk + stride),
+                                         partialResult(chunk), packs);
+                    }
+                }
+            }
 
-            ++intermediateIt;
+            copy(partialResults.cbegin(),
+                 partialResults.cbegin() + static_cast<int64_t>(packs),
+                 resultVector.packs().begin());
         }
+
+        // Computes the result packs of one row panel over all columns, so
+        // that the panels are independent of each other and need no merge.
+        // Like the TransformOperation of the single-threaded avx2-variant,
+        // it sweeps the columns in the outer loop.
+        class PanelOperation
+        {
+            const SOAMatrix & _matrix;
+            const AVXVector & _inputVector;
+            AVXVector & _resultVector;
+            size_t _panelPacks;
+            const EpilogueOperation & _epilogueOp;
+            bool _streamingStores;
+            size_t _prefetchDistance;
+
+          public:
+            PanelOperation(const SOAMatrix & matrix,
+                           const AVXVector & inputVector,
+                           AVXVector & resultVector, const size_t panelPacks,
+                           const EpilogueOperation & epilogueOp,
+                           const TransformOptions & options) noexcept
+                : _matrix(matrix), _inputVector(inputVector),
+                  _resultVector(resultVector), _panelPacks(panelPacks),
+                  _epilogueOp(epilogueOp),
+                  _streamingStores(usesStreamingStores(options.storeMode,
+                                                       matrix.rows())),
+                  _prefetchDistance(options.prefetchDistance)
+            {
+                assert(panelPacks > 0);
+            }
+
+            void operator()(const size_t panel) const noexcept
+            {
+                const tracing::PhaseScope compute{tracing::Phase::COMPUTE};
+
+                const auto packsPerColumn = padSize(this->_matrix.rows());
+                const auto columns = this->_matrix.columns();
+                const auto firstPack = panel * this->_panelPacks;
+                const auto lastPack =
+                    min(firstPack + this->_panelPacks, packsPerColumn);
+
+                auto & resultPacks = this->_resultVector.packs();
+                const auto dataStart =
+                    this->_matrix.packs().cbegin() +
+                    static_cast<int64_t>(firstPack);
+
+                // The packs following a panel in its column belong to other
+                // panels, so that the prefetches stay in the panel: they
+                // target the same packs as many columns ahead as the
+                // distance spans panels, but at least one.
+                const auto panelLength = lastPack - firstPack;
+                const auto prefetchPacks =
+                    (this->_prefetchDistance + panelLength - 1) / panelLength *
+                    packsPerColumn;
+
+                size_t c{0};
+                for (auto && inputPack : this->_inputVector.packs())
+                {
+                    // Thanks to the padding we can safely load partials of
+                    // the data into one whole AVX register at once.
+                    const auto partialInput = _mm256_load_ps(inputPack.data());
+
+                    for (auto i = int{0};
+                         i < int{NUM_FLOATS_PER_AVX_REGISTER} && c < columns;
+                         ++i, ++c)
+                    {
+                        const auto inputBroadcast = broadcast(partialInput, i);
+                        const auto isLastColumn = c + 1 == columns;
+
+                        auto rowIt = dataStart +
+                                     static_cast<int64_t>(c * packsPerColumn);
+                        for (auto p = firstPack; p < lastPack; ++p, ++rowIt)
+                        {
+                            if (prefetchPacks > 0)
+                            {
+                                prefetchAhead(*rowIt, prefetchPacks);
+                            }
+
+                            const auto resultData = resultPacks[p].data();
+                            const auto sumPack = _mm256_add_ps(
+                                _mm256_mul_ps(_mm256_load_ps(rowIt->data()),
+                                              inputBroadcast),
+                                _mm256_load_ps(resultData));
+
+                            // The last column finalizes the panel, so that
+                            // the epilogue is fused into its store.
+                            if (isLastColumn)
+                            {
+                                storeResult(resultData,
+                                            this->_epilogueOp(sumPack, p),
+                                            this->_streamingStores);
+                            }
+                            else
+                            {
+                                _mm256_store_ps(resultData, sumPack);
+                            }
+                        }
+                    }
+                }
+
+                if (this->_streamingStores)
+                {
+                    _mm_sfence();
+                }
+            }
+        };
     }
 
     AVXVector transformMultiThreaded(const SOAMatrix & matrix,
                                      const AVXVector & inputVector) noexcept
+    {
+        return transformMultiThreaded(matrix, inputVector, TransformOptions{});
+    }
+
+    AVXVector transformMultiThreaded(const SOAMatrix & matrix,
+                                     const AVXVector & inputVector,
+                                     const TransformOptions & options) noexcept
+    {
+        auto resultVector = allocateResult(matrix.rows());
+        transformMultiThreaded(matrix, inputVector, options, resultVector);
+        return resultVector;
+    }
+
+    void transformMultiThreaded(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                AVXVector & resultVector) noexcept
+    {
+        transformMultiThreaded(matrix, inputVector, TransformOptions{},
+                               resultVector);
+    }
+
+    void transformMultiThreaded(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                const TransformOptions & options,
+                                AVXVector & resultVector) noexcept
     {
         assert(inputVector.size() == matrix.columns());
+        assert(resultVector.size() == matrix.rows());
+        assert(matrix.rows() > 0);
+        assert(options.epilogue.bias == nullptr ||
+               options.epilogue.bias->size() == matrix.rows());
 
-        const auto rows = matrix.rows();
-        const auto columns = matrix.columns();
+        const tracing::PhaseScope call{tracing::Phase::CALL};
+
+        const auto packs = padSize(matrix.rows());
+        const auto threads = static_cast<size_t>(omp_get_max_threads());
+        const auto panelPacks =
+            clamp(packs / (threads * PANELS_PER_THREAD), size_t{1},
+                  MAX_PANEL_PACKS);
+        const auto panels = (packs + panelPacks - 1) / panelPacks;
 
-        TransformOperation transformOp{rows, matrix.packs().cbegin()};
-        AVXVector resultVector{rows, 0.0F};
+        const EpilogueOperation epilogueOp{options.epilogue};
+        fill(resultVector.packs().begin(), resultVector.packs().end(),
+             AVXPack{});
 
-        // Remember that we have the SOA layout, so we iterate on the
-        // columns in the outer most loop. in the inner loop, we vertically
-        // do the partial dot product step by step.
-        size_t c{0};
-        for (auto && inputPack : inputVector.packs())
+        // Each row panel is a task of the work-stealing scheduler, which
+        // balances the panels dynamically when some threads fall behind.
+        const PanelOperation panelOp{matrix,     inputVector, resultVector,
+                                     panelPacks, epilogueOp,  options};
+        scheduling::runWorkStealing(panels, panelOp);
+
+        restorePadding(resultVector);
+    }
+
+    AVXVector transformSplitColumnsMultiThreaded(
+        const SOAMatrix & matrix, const AVXVector & inputVector) noexcept
+    {
+        return transformSplitColumnsMultiThreaded(matrix, inputVector,
+                                                  TransformOptions{});
+    }
+
+    AVXVector transformSplitColumnsMultiThreaded(
+        const SOAMatrix & matrix, const AVXVector & inputVector,
+        const TransformOptions & options) noexcept
+    {
+        auto resultVector = allocateResult(matrix.rows());
+        transformSplitColumnsMultiThreaded(matrix, inputVector, options,
+                                           resultVector);
+        return resultVector;
+    }
+
+    void transformSplitColumnsMultiThreaded(const SOAMatrix & matrix,
+                                            const AVXVector & inputVector,
+                                            const TransformOptions & options,
+                                            AVXVector & resultVector) noexcept
+    {
+        assert(inputVector.size() == matrix.columns());
+        assert(resultVector.size() == matrix.rows());
+        assert(options.epilogue.bias == nullptr ||
+               options.epilogue.bias->size() == matrix.rows());
+
+        const tracing::PhaseScope call{tracing::Phase::CALL};
+
+        if (options.reductionMode == ReductionMode::REPRODUCIBLE)
+        {
+            transformSplitColumnsReproducible(matrix, inputVector,
+                                              resultVector);
+        }
+        else
+        {
+            fill(resultVector.packs().begin(), resultVector.packs().end(),
+                 AVXPack{});
+            transformSplitColumnsFast(matrix, inputVector, resultVector);
+        }
+
+        // The epilogue needs the complete sums, so it takes a pass of its
+        // own, which is cheap for the few rows this variant is meant for.
+        const tracing::PhaseScope epilogue{tracing::Phase::EPILOGUE};
+        const EpilogueOperation epilogueOp{options.epilogue};
+        const auto streaming =
+            usesStreamingStores(options.storeMode, matrix.rows());
+        auto & resultPacks = resultVector.packs();
+        for (size_t p{0}; p < resultPacks.size(); ++p)
+        {
+            const auto resultData = resultPacks[p].data();
+            storeResult(resultData,
+                        epilogueOp(_mm256_load_ps(resultData), p), streaming);
+        }
+        if (streaming)
+        {
+            _mm_sfence();
+        }
+
+        restorePadding(resultVector);
+    }
+
+    AVXVector transformPackedMultiThreaded(
+        const PackedMatrix & matrix, const AVXVector & inputVector) noexcept
+    {
+        auto resultVector = allocateResult(matrix.rows());
+        transformPackedMultiThreaded(matrix, inputVector, resultVector);
+        return resultVector;
+    }
+
+    void transformPackedMultiThreaded(const PackedMatrix & matrix,
+                                      const AVXVector & inputVector,
+                                      AVXVector & resultVector) noexcept
+    {
+        transformPackedMultiThreaded(
+            matrix, inputVector, resultVector,
+            static_cast<size_t>(omp_get_max_threads()));
+    }
+
+    void transformPackedMultiThreaded(const PackedMatrix & matrix,
+                                      const AVXVector & inputVector,
+                                      AVXVector & resultVector,
+                                      const size_t requestedThreads) noexcept
+    {
+        assert(requestedThreads > 0);
+
+        const tracing::PhaseScope call{tracing::Phase::CALL};
+        const auto rowPanels = matrix.rowPanels();
+
+        // The row panels cost the same, so that a static split balances
+        // them.
+#pragma omp parallel num_threads(static_cast<int>(requestedThreads))
         {
-            // Thanks to the padding we can safely load partials of the data
-            // into one whole AVX register at once.
-            const auto partialInput = _mm256_load_ps(inputPack.data());
+            const auto threads = static_cast<size_t>(omp_get_num_threads());
+            const auto thread = static_cast<size_t>(omp_get_thread_num());
+            const tracing::PhaseScope compute{tracing::Phase::COMPUTE};
+            transformPacked(matrix, inputVector, resultVector,
+                            rowPanels * thread / threads,
+                            rowPanels * (thread + 1) / threads);
+        }
 
-            // We loop NUM_FLOATS_PER_AVX_REGISTER-times on the partial input
-            // vector and broadcast each element for each iteration.
+        restorePadding(resultVector);
+    }
 
-            // And we use openmp for each iteration in that loop when the
+    void gerMultiThreaded(SOAMatrix & matrix, const float alpha,
+                          const AVXVector & u, const AVXVector & v) noexcept
+    {
+        const auto columns = matrix.columns();
+
+        // The columns cost the same, so that a static split balances them.
 #pragma omp parallel
-            {
-                AVXVector intermediateVector{rows, 0.0F};
+        {
+            const auto threads = static_cast<size_t>(omp_get_num_threads());
+            const auto thread = static_cast<size_t>(omp_get_thread_num());
+            ger(matrix, alpha, u, v, columns * thread / threads,
+                columns * (thread + 1) / threads);
+        }
+    }
+
+    SOAMatrix multiplyMultiThreaded(const SOAMatrix & a,
+                                    const SOAMatrix & b) noexcept
+    {
+        assert(a.columns() == b.rows());
+
+        // The elements start at zero, and the padding is restored at the end.
+        SOAMatrix result{a.rows(), b.columns()};
+
+        const auto packsPerColumn = padSize(a.rows());
+        const auto inner = a.columns();
+        const auto blocks =
+            (packsPerColumn + GEMM_BLOCK_PACKS - 1) / GEMM_BLOCK_PACKS;
+
+        // One packed panel of B, which all threads pack and read together.
+        vector<float> packedB(GEMM_PANEL_COLUMNS * GEMM_PANEL_DEPTH);
+
+#pragma omp parallel
+        {
+            const auto threads = static_cast<size_t>(omp_get_num_threads());
+            vector<AVXPack> packedA(GEMM_BLOCK_PACKS * GEMM_PANEL_DEPTH);
 
-#pragma omp for nowait
-                for (auto i = int{0}; i < int{NUM_FLOATS_PER_AVX_REGISTER}; ++i)
+            for (size_t jc{0}; jc < b.columns(); jc += GEMM_PANEL_COLUMNS)
+            {
+                const auto width = min(GEMM_PANEL_COLUMNS, b.columns() - jc);
+                for (size_t pc{0}; pc < inner; pc += GEMM_PANEL_DEPTH)
                 {
-                    const auto inputBroadcast = broadcast(partialInput, i);
-                    if ((c + i) < columns)
+                    const GemmPanel panel{pc, min(GEMM_PANEL_DEPTH, inner - pc),
+                                          jc, width};
+                    const auto tiles = panel.tiles();
+
+#pragma omp for schedule(static)
+                    for (size_t tile = 0; tile < tiles; ++tile)
                     {
-                        AVXVector product = transformOp(
-                            c + static_cast<size_t>(i), inputBroadcast);
+                        packGemmPanel(b, panel, tile, tile + 1, packedB);
+                    }
 
-                        mergeIntermediateIntoResult(product,
-                                                    intermediateVector);
+                    // Blocks of A by ranges of tiles, so that all threads get
+                    // work even if A has fewer row blocks than there are
+                    // threads. Each block of A is packed once per range.
+                    const auto ranges =
+                        min(tiles, (threads + blocks - 1) / blocks);
+#pragma omp for schedule(static)
+                    for (size_t work = 0; work < blocks * ranges; ++work)
+                    {
+                        const auto ic = work / ranges * GEMM_BLOCK_PACKS;
+                        const auto range = work % ranges;
+                        multiplyGemmBlock(
+                            a, panel, packedB, ic,
+                            min(GEMM_BLOCK_PACKS, packsPerColumn - ic),
+                            tiles * range / ranges,
+                            tiles * (range + 1) / ranges, packedA, result);
                     }
                 }
+            }
 
-#pragma omp critical
+            const auto thread = static_cast<size_t>(omp_get_thread_num());
+            restoreGemmPadding(result, b.columns() * thread / threads,
+                               b.columns() * (thread + 1) / threads);
+        }
+
+        return result;
+    }
+
+    void transformArenaMultiThreaded(const MatrixArena & matrices,
+                                     const VectorArena & inputs,
+                                     VectorArena & results) noexcept
+    {
+        const auto pairs = matrices.size();
+        const auto totalPacks = matrices.packs().size();
+
+        // The first packs of the matrices are the prefix sums of their pack
+        // counts, which measure the work of the pairs.
+        const auto firstPairFrom = [&](const size_t pack) {
+            size_t low{0};
+            auto high = pairs;
+            while (low < high)
+            {
+                const auto middle = low + (high - low) / 2;
+                if (matrices.firstPack(middle) < pack)
+                {
+                    low = middle + 1;
+                }
+                else
                 {
-                    mergeIntermediateIntoResult(intermediateVector,
-                                                resultVector);
+                    high = middle;
                 }
             }
+            return low;
+        };
 
-            c += NUM_FLOATS_PER_AVX_REGISTER;
+#pragma omp parallel
+        {
+            const auto threads = static_cast<size_t>(omp_get_num_threads());
+            const auto thread = static_cast<size_t>(omp_get_thread_num());
+            const auto first = firstPairFrom(totalPacks * thread / threads);
+            const auto last = thread + 1 == threads
+                                  ? pairs
+                                  : firstPairFrom(totalPacks * (thread + 1) /
+                                                  threads);
+            transformArena(matrices, inputs, results, first, last);
         }
+    }
 
-        return resultVector;
+    void executeMultiThreaded(const TransformPlan & plan,
+                              const SOAMatrix & matrix,
+                              const AVXVector & inputVector,
+                              AVXVector & result) noexcept
+    {
+        const tracing::PhaseScope call{tracing::Phase::CALL};
+        const auto plannedThreads = plan.threads();
+        if (plannedThreads == 1)
+        {
+            plan.execute(matrix, inputVector, result);
+            return;
+        }
+
+#pragma omp parallel num_threads(static_cast<int>(plannedThreads))
+        {
+            // The runtime may provide fewer threads than requested, which
+            // then run the parts of the missing ones in turn.
+            const auto threads = static_cast<size_t>(omp_get_num_threads());
+            const tracing::PhaseScope compute{tracing::Phase::COMPUTE};
+            for (auto thread = static_cast<size_t>(omp_get_thread_num());
+                 thread < plannedThreads; thread += threads)
+            {
+                plan.execute(matrix, inputVector, result, thread);
+            }
+        }
+
+        plan.finish(result);
     }
 }
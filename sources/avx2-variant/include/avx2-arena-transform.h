@@ -0,0 +1,24 @@
+#pragma once
+
+#include <avx2-arena.h>
+
+#include <cstddef>
+
+namespace matrixmultiplication::avx2
+{
+    // Performs the matrix-vector multiplication of each matrix in the arena
+    // with the input vector of the same index into the result vector of the
+    // same index, which must have the rows of its matrix (see resultArena).
+    // Nothing is allocated, and each pair runs a kernel that keeps blocks
+    // of up to 64 result rows in registers.
+    void transformArena(const MatrixArena & matrices,
+                        const VectorArena & inputs,
+                        VectorArena & results) noexcept;
+
+    // Performs only the multiplications of the pairs in [first, last). The
+    // other results stay untouched.
+    void transformArena(const MatrixArena & matrices,
+                        const VectorArena & inputs, VectorArena & results,
+                        const std::size_t first,
+                        const std::size_t last) noexcept;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // Performs the RxC * Cx1 -> Rx1 matrix-vector multiplication of one
+    // matrix with each of the input vectors. The matrix is streamed once for
+    // the whole batch instead of once per input vector, which turns the
+    // memory bound single transformations into one more compute bound pass.
+    std::vector<AVXVector> transformBatch(
+        const SOAMatrix & matrix,
+        const std::vector<const AVXVector *> & inputVectors) noexcept;
+}
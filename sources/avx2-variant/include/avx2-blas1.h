@@ -0,0 +1,104 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <utility>
+
+// Level-1 operations on whole vectors, which work on the packs directly.
+// The padding (-0.0) adds nothing to the sums, so that no operation handles
+// a tail. The operations that write restore the padding, as negative
+// factors and products flip its sign.
+//
+// The reductions sum blocks of REDUCTION_BLOCK_PACKS packs each and add the
+// partial sums of the blocks in their order, so that a result depends on
+// the size of the vectors only and not on how the blocks are split among
+// threads.
+namespace matrixmultiplication::avx2
+{
+    // The packs per partial sum of the reductions.
+    constexpr std::size_t REDUCTION_BLOCK_PACKS{128};
+
+    // The count of partial sums of a reduction over the vector.
+    std::size_t reductionBlocks(const AVXVector & x) noexcept;
+
+    // Adds the partial sums of the reduction blocks in their order.
+    float sumPartials(const AVXPack * partials,
+                      const std::size_t blocks) noexcept;
+
+    // Returns x . y.
+    float dot(const AVXVector & x, const AVXVector & y) noexcept;
+
+    // Returns x . x.
+    float squaredNorm(const AVXVector & x) noexcept;
+
+    // Returns the Euclidean norm of x.
+    float norm(const AVXVector & x) noexcept;
+
+    // Returns x . y and y . y in one pass.
+    std::pair<float, float> dotAndSquaredNorm(const AVXVector & x,
+                                              const AVXVector & y) noexcept;
+
+    // Computes x *= alpha.
+    void scale(const float alpha, AVXVector & x) noexcept;
+
+    // Computes y += alpha * x.
+    void axpy(const float alpha, const AVXVector & x, AVXVector & y) noexcept;
+
+    // Computes y = alpha * x + beta * y.
+    void axpby(const float alpha, const AVXVector & x, const float beta,
+               AVXVector & y) noexcept;
+
+    // Computes y = alpha * x + beta * y and returns the new y . y in the
+    // same pass.
+    float axpbyAndSquaredNorm(const float alpha, const AVXVector & x,
+                              const float beta, AVXVector & y) noexcept;
+
+    // Computes result = x + y element-wise.
+    void add(const AVXVector & x, const AVXVector & y,
+             AVXVector & result) noexcept;
+
+    // Computes result = x * y element-wise.
+    void multiplyElementwise(const AVXVector & x, const AVXVector & y,
+                             AVXVector & result) noexcept;
+
+    // Like the reductions above, but for the blocks [firstBlock, lastBlock)
+    // only, so that the blocks can be split among threads. Stores the
+    // partial sum of block b at partials[b] for sumPartials. Leaves
+    // restoring the padding of a written vector to the caller.
+    void dot(const AVXVector & x, const AVXVector & y,
+             const std::size_t firstBlock, const std::size_t lastBlock,
+             AVXPack * partials) noexcept;
+
+    void squaredNorm(const AVXVector & x, const std::size_t firstBlock,
+                     const std::size_t lastBlock, AVXPack * partials) noexcept;
+
+    void dotAndSquaredNorm(const AVXVector & x, const AVXVector & y,
+                           const std::size_t firstBlock,
+                           const std::size_t lastBlock,
+                           AVXPack * dotPartials,
+                           AVXPack * squaredNormPartials) noexcept;
+
+    void axpbyAndSquaredNorm(const float alpha, const AVXVector & x,
+                             const float beta, AVXVector & y,
+                             const std::size_t firstBlock,
+                             const std::size_t lastBlock,
+                             AVXPack * partials) noexcept;
+
+    // Like the element-wise operations above, but for the packs
+    // [firstPack, lastPack) only, so that the packs can be split among
+    // threads. Leaves restoring the padding to the caller.
+    void scale(const float alpha, AVXVector & x, const std::size_t firstPack,
+               const std::size_t lastPack) noexcept;
+
+    void axpby(const float alpha, const AVXVector & x, const float beta,
+               AVXVector & y, const std::size_t firstPack,
+               const std::size_t lastPack) noexcept;
+
+    void add(const AVXVector & x, const AVXVector & y, AVXVector & result,
+             const std::size_t firstPack, const std::size_t lastPack) noexcept;
+
+    void multiplyElementwise(const AVXVector & x, const AVXVector & y,
+                             AVXVector & result, const std::size_t firstPack,
+                             const std::size_t lastPack) noexcept;
+}
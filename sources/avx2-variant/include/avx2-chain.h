@@ -0,0 +1,50 @@
+#pragma once
+
+#include <avx2-epilogue.h>
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // One step of a TransformChain, e.g. with relu(&bias) as epilogue.
+    struct ChainLayer
+    {
+        const SOAMatrix * matrix;
+        Epilogue epilogue{};
+    };
+
+    // Applies a sequence of matrices to an input vector, like the layers of a
+    // neural network: y = A_n * ... * A_2 * A_1 * x. The intermediate results
+    // live in two ping-pong buffers sized to the widest layer, which are
+    // allocated once with the chain. The epilogue of each layer is applied in
+    // its last column pass, so it does not cost an extra pass over the
+    // intermediate result.
+    class TransformChain
+    {
+        std::vector<ChainLayer> _layers;
+
+        // Layers whose intermediate results fit together into this many
+        // bytes consume the result of the previous layer pack by pack while
+        // it is produced, instead of after it was completed.
+        std::size_t _fusionBudget;
+
+        AVXVector _ping;
+        AVXVector _pong;
+
+        bool isFused(const std::size_t layer) const noexcept;
+
+      public:
+        // Uses the L2 cache size of the host as fusion budget.
+        explicit TransformChain(std::vector<ChainLayer> layers) noexcept;
+
+        TransformChain(std::vector<ChainLayer> layers,
+                       const std::size_t fusionBudget) noexcept;
+
+        // Performs the transformation of all layers. The returned vector is
+        // one of the ping-pong buffers and is therefore only valid until the
+        // next call.
+        const AVXVector & operator()(const AVXVector & inputVector) noexcept;
+    };
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <avx2-fixed-model.h>
+
+#include <cstddef>
+#include <utility>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+namespace matrixmultiplication::avx2
+{
+    namespace fixed
+    {
+        // Adds the product of column c and its broadcast input element to
+        // each of the P partial result packs.
+        template <std::size_t c, std::size_t R, std::size_t C,
+                  std::size_t... p>
+        inline void multiplyAddColumn(const FixedMatrix<R, C> & matrix,
+                                      const FixedVector<C> & inputVector,
+                                      __m256 * sums,
+                                      std::index_sequence<p...>) noexcept
+        {
+            constexpr auto PACKS = FixedMatrix<R, C>::PACKS_PER_COLUMN;
+
+            const auto inputBroadcast = _mm256_broadcast_ss(
+                &inputVector.packs()[c / NUM_FLOATS_PER_AVX_REGISTER]
+                                    [c % NUM_FLOATS_PER_AVX_REGISTER]);
+            ((sums[p] = _mm256_add_ps(
+                  _mm256_mul_ps(
+                      _mm256_load_ps(matrix.packs()[c * PACKS + p].data()),
+                      inputBroadcast),
+                  sums[p])),
+             ...);
+        }
+
+        // Even and odd columns accumulate into separate registers, which
+        // halves the chains of dependent adds.
+        template <std::size_t R, std::size_t C, std::size_t... c>
+        inline void multiplyAddColumns(const FixedMatrix<R, C> & matrix,
+                                       const FixedVector<C> & inputVector,
+                                       __m256 * evenSums, __m256 * oddSums,
+                                       std::index_sequence<c...>) noexcept
+        {
+            constexpr auto packs = std::make_index_sequence<
+                FixedMatrix<R, C>::PACKS_PER_COLUMN>{};
+            (multiplyAddColumn<c>(matrix, inputVector,
+                                  c % 2 == 0 ? evenSums : oddSums, packs),
+             ...);
+        }
+    }
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication of fixed
+    // shape. The loops over the columns and packs are fully unrolled at
+    // compile time, the partial results stay in registers, and nothing is
+    // allocated on the heap.
+    template <std::size_t R, std::size_t C>
+    FixedVector<R> transform(const FixedMatrix<R, C> & matrix,
+                             const FixedVector<C> & inputVector) noexcept
+    {
+        constexpr auto PACKS = FixedVector<R>::PACKS;
+
+        __m256 evenSums[PACKS];
+        __m256 oddSums[PACKS];
+        for (std::size_t p{0}; p < PACKS; ++p)
+        {
+            evenSums[p] = _mm256_setzero_ps();
+            oddSums[p] = _mm256_setzero_ps();
+        }
+
+        fixed::multiplyAddColumns(matrix, inputVector, evenSums, oddSums,
+                                  std::make_index_sequence<C>{});
+
+        FixedVector<R> result;
+        for (std::size_t p{0}; p < PACKS; ++p)
+        {
+            _mm256_store_ps(result.packs()[p].data(),
+                            _mm256_add_ps(evenSums[p], oddSums[p]));
+        }
+
+        // The padding of the result gets its value back.
+        for (auto i = R; i < PACKS * NUM_FLOATS_PER_AVX_REGISTER; ++i)
+        {
+            result.at(i) = PADDING_VALUE;
+        }
+        return result;
+    }
+}
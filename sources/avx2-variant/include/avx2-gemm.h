@@ -0,0 +1,82 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // Count of result columns one micro-kernel tile computes. Column ranges
+    // starting at multiples of it avoid partial tiles.
+    constexpr std::size_t GEMM_TILE_COLUMNS{6};
+
+    // Cache blocking: a panel of B of GEMM_PANEL_DEPTH rows by
+    // GEMM_PANEL_COLUMNS columns (1.5MB) stays in the L3 cache, and a block
+    // of A of GEMM_BLOCK_PACKS row packs by GEMM_PANEL_DEPTH columns (128KB)
+    // in the L2 cache.
+    constexpr std::size_t GEMM_PANEL_DEPTH{256};
+    constexpr std::size_t GEMM_PANEL_COLUMNS{1536};
+    constexpr std::size_t GEMM_BLOCK_PACKS{16};
+
+    // A block of B of the rows [firstRow, firstRow + depth) and the columns
+    // [firstColumn, firstColumn + width), of at most GEMM_PANEL_DEPTH rows
+    // and GEMM_PANEL_COLUMNS columns.
+    struct GemmPanel
+    {
+        std::size_t firstRow;
+        std::size_t depth;
+        std::size_t firstColumn;
+        std::size_t width;
+
+        // The count of tiles of GEMM_TILE_COLUMNS columns, the last of which
+        // may be partial.
+        std::size_t tiles() const noexcept
+        {
+            return (this->width + GEMM_TILE_COLUMNS - 1) / GEMM_TILE_COLUMNS;
+        }
+    };
+
+    // Performs a MxK * KxN -> MxN matrix-matrix multiplication. The operands
+    // are copied block-wise into packed panels, which a register-blocked
+    // micro-kernel streams from the caches, so that A is not read from
+    // memory once per column of B.
+    SOAMatrix multiply(const SOAMatrix & a, const SOAMatrix & b) noexcept;
+
+    // Computes the columns in [firstColumn, lastColumn) of the product of A
+    // and B into the result, which must have the shape of the product.
+    // Other columns of the result stay untouched.
+    void multiply(const SOAMatrix & a, const SOAMatrix & b, SOAMatrix & result,
+                  const std::size_t firstColumn,
+                  const std::size_t lastColumn) noexcept;
+
+    // The building blocks of multiply, which let several threads share one
+    // packed panel of B.
+
+    // Copies the tiles [firstTile, lastTile) of the panel of B into the
+    // order of the micro-kernel. The packed panel holds GEMM_PANEL_DEPTH *
+    // GEMM_PANEL_COLUMNS floats, of which threads may pack disjoint tiles
+    // concurrently.
+    void packGemmPanel(const SOAMatrix & b, const GemmPanel & panel,
+                       const std::size_t firstTile, const std::size_t lastTile,
+                       std::vector<float> & packedB) noexcept;
+
+    // Multiplies the row packs [firstPack, firstPack + packs) of A, at most
+    // GEMM_BLOCK_PACKS, by the tiles [firstTile, lastTile) of the packed
+    // panel of B and adds the products to the result. The caller provides
+    // packedA of GEMM_BLOCK_PACKS * GEMM_PANEL_DEPTH packs, into which the
+    // block of A is copied. The padding of the result is left to
+    // restoreGemmPadding.
+    void multiplyGemmBlock(const SOAMatrix & a, const GemmPanel & panel,
+                           const std::vector<float> & packedB,
+                           const std::size_t firstPack, const std::size_t packs,
+                           const std::size_t firstTile,
+                           const std::size_t lastTile,
+                           std::vector<AVXPack> & packedA,
+                           SOAMatrix & result) noexcept;
+
+    // Restores the padding of the result columns in [firstColumn,
+    // lastColumn), which the padding rows of A may have changed.
+    void restoreGemmPadding(SOAMatrix & result, const std::size_t firstColumn,
+                            const std::size_t lastColumn) noexcept;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // A new value of one element of the input vector.
+    struct InputChange
+    {
+        std::size_t index;
+        float value;
+    };
+
+    struct IncrementalOptions
+    {
+        // Deltas changing more than this fraction of the columns fall back
+        // to a full recomputation, which costs about as much per column.
+        double fullRecomputeFraction{0.5};
+
+        // Every this many incremental updates, the result is recomputed in
+        // full, which bounds the floating-point drift of the accumulated
+        // deltas.
+        std::size_t refreshInterval{1024};
+    };
+
+    struct IncrementalStats
+    {
+        std::size_t incrementalUpdates;
+        std::size_t fullRecomputes;
+    };
+
+    // Keeps the input and the result of a transformation, and updates the
+    // result for sparse changes of the input. Each changed element adds the
+    // product of its matrix column and the difference to its previous value
+    // to the result, so that an update costs one column pass per change
+    // instead of one per column. The matrix must outlive the transformer.
+    class IncrementalTransform
+    {
+        const SOAMatrix & _matrix;
+        IncrementalOptions _options;
+        AVXVector _input;
+        AVXVector _result;
+        std::size_t _updatesSinceRefresh{0};
+        IncrementalStats _stats{0, 0};
+
+        void recompute() noexcept;
+
+      public:
+        IncrementalTransform(
+            const SOAMatrix & matrix, const AVXVector & inputVector,
+            const IncrementalOptions & options = IncrementalOptions{}) noexcept;
+
+        // Applies the changes in their order and returns the updated result.
+        const AVXVector & update(
+            const std::vector<InputChange> & changes) noexcept;
+
+        const AVXVector & input() const noexcept;
+        const AVXVector & result() const noexcept;
+        IncrementalStats stats() const noexcept;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <avx2-packed-model.h>
+
+#include <cstddef>
+
+namespace matrixmultiplication::avx2
+{
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication by a matrix
+    // repacked into kernel order. The packs of each row panel are kept in
+    // registers while its columns stream by, so that the matrix is read
+    // once as one linear stream and each result pack is stored once per
+    // column panel.
+    AVXVector transformPacked(const PackedMatrix & matrix,
+                              const AVXVector & inputVector) noexcept;
+
+    // Like transformPacked, but into the given result of R elements.
+    void transformPacked(const PackedMatrix & matrix,
+                         const AVXVector & inputVector,
+                         AVXVector & resultVector) noexcept;
+
+    // Like transformPacked, but for the row panels [firstRowPanel,
+    // lastRowPanel) only, so that the row panels can be split among threads.
+    // Leaves restoring the padding of the result to the caller.
+    void transformPacked(const PackedMatrix & matrix,
+                         const AVXVector & inputVector,
+                         AVXVector & resultVector,
+                         const std::size_t firstRowPanel,
+                         const std::size_t lastRowPanel) noexcept;
+}
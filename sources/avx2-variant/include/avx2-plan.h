@@ -0,0 +1,126 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <avx2-transform-options.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // How a TransformPlan computes its result packs.
+    enum class PlanKernel
+    {
+        // Register-blocked for matrices of up to SMALL_KERNEL_MAX_ROWS rows
+        // and column passes otherwise, like transform dispatches.
+        AUTOMATIC,
+
+        // Sweeps the columns over the whole range of result packs of a
+        // thread, like transform.
+        COLUMN_PASSES,
+
+        // Keeps blocks of up to eight result packs in registers while the
+        // columns stream by, like transformSmall.
+        REGISTER_BLOCKED
+    };
+
+    struct PlanOptions
+    {
+        // The epilogue and its bias are bound to the plan, so that the bias
+        // must outlive it.
+        TransformOptions transform{};
+
+        PlanKernel kernel{PlanKernel::AUTOMATIC};
+
+        // The count of threads the result packs are split among. A plan
+        // executed single-threaded runs the parts of all threads in turn.
+        std::size_t threads{1};
+    };
+
+    // A RxC * Cx1 -> Rx1 matrix-vector multiplication prepared once for a
+    // shape, like a plan of FFTW. Creating the plan resolves the kernel, the
+    // epilogue and the store mode, and splits the result packs into the
+    // segments of each thread. Executing it then allocates nothing and does
+    // not branch on the shape, which pays off for small shapes transformed
+    // many times. The result equals the one of transform.
+    class TransformPlan
+    {
+        // A contiguous range of result packs, which the segment kernel of
+        // the plan computes over all columns. Register-blocked segments hold
+        // up to REGISTER_BLOCK_MAX_PACKS packs.
+        struct Segment
+        {
+            std::size_t firstPack;
+            std::size_t lastPack;
+        };
+
+        using SegmentKernel = void (*)(const TransformPlan &, const Segment &,
+                                       const AVXPack *, const AVXPack *,
+                                       AVXPack *) noexcept;
+
+        std::size_t _rows;
+        std::size_t _columns;
+        std::size_t _packsPerColumn;
+        std::size_t _threads;
+        PlanKernel _kernel;
+        EpilogueOperation _epilogueOp;
+        bool _streamingStores;
+        std::size_t _prefetchDistance;
+        SegmentKernel _segmentKernel;
+
+        // The segments of thread t are [_threadSegments[t],
+        // _threadSegments[t + 1]).
+        std::vector<Segment> _segments;
+        std::vector<std::size_t> _threadSegments;
+
+        static void columnPasses(const TransformPlan & plan,
+                                 const Segment & segment,
+                                 const AVXPack * matrix, const AVXPack * input,
+                                 AVXPack * result) noexcept;
+
+        static void prefetchedColumnPasses(const TransformPlan & plan,
+                                           const Segment & segment,
+                                           const AVXPack * matrix,
+                                           const AVXPack * input,
+                                           AVXPack * result) noexcept;
+
+        static void registerBlocked(const TransformPlan & plan,
+                                    const Segment & segment,
+                                    const AVXPack * matrix,
+                                    const AVXPack * input,
+                                    AVXPack * result) noexcept;
+
+        static void registerBlockedWithEpilogue(const TransformPlan & plan,
+                                                const Segment & segment,
+                                                const AVXPack * matrix,
+                                                const AVXPack * input,
+                                                AVXPack * result) noexcept;
+
+      public:
+        TransformPlan(const std::size_t rows, const std::size_t columns,
+                      const PlanOptions & options = {}) noexcept;
+
+        std::size_t rows() const noexcept;
+        std::size_t columns() const noexcept;
+        std::size_t threads() const noexcept;
+
+        // The kernel AUTOMATIC resolved to.
+        PlanKernel kernel() const noexcept;
+
+        // Transforms the input vector by a matrix of the planned shape into
+        // the given result of R elements.
+        void execute(const SOAMatrix & matrix, const AVXVector & inputVector,
+                     AVXVector & result) const noexcept;
+
+        // Like execute, but only the segments bound to the given thread, so
+        // that the threads can run their parts in parallel. Leaves finish
+        // to the caller once all threads are done.
+        void execute(const SOAMatrix & matrix, const AVXVector & inputVector,
+                     AVXVector & result,
+                     const std::size_t thread) const noexcept;
+
+        // Restores the padding of the result after the parts of all
+        // threads were executed.
+        void finish(AVXVector & result) const noexcept;
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+
+namespace matrixmultiplication::avx2
+{
+    // Matrices of up to this many rows are transformed by kernels that keep
+    // the whole result in registers.
+    constexpr std::size_t SMALL_KERNEL_MAX_ROWS{64};
+
+    // Whether transformSmall supports the shape of the matrix.
+    bool isSmallShape(const SOAMatrix & matrix) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication of a small
+    // matrix into the given result of R elements, so that repeated calls
+    // allocate nothing. A kernel specialized for the count of row packs
+    // keeps the partial results in registers for the whole column loop and
+    // stores them once. The result equals the one of transform.
+    void transformSmall(const SOAMatrix & matrix, const AVXVector & inputVector,
+                        AVXVector & result) noexcept;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::avx2
+{
+    // One non-zero element of a sparse input vector.
+    struct SparseElement
+    {
+        std::size_t index;
+        float value;
+    };
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication with an input
+    // vector given by its non-zero elements. Only the columns of the given
+    // elements are read, so the cost scales with their count times R.
+    // Elements of the same index add up.
+    AVXVector transformSparse(const SOAMatrix & matrix,
+                              const std::vector<SparseElement> & inputElements)
+        noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication, which skips
+    // the columns of the zero elements in the input vector. Worth it for
+    // mostly zero inputs, as the non-zero elements are found per input pack
+    // with a vector compare.
+    AVXVector transformSparse(const SOAMatrix & matrix,
+                              const AVXVector & inputVector) noexcept;
+
+    // Collects the non-zero elements of the vector.
+    std::vector<SparseElement> nonZeroElements(
+        const AVXVector & vector) noexcept;
+}
@@ -1,10 +1,41 @@
 #pragma once
 
 #include <avx2-model.h>
+#include <avx2-transform-options.h>
+
+#include <cstddef>
 
 namespace matrixmultiplication::avx2
 {
-    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication.
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication. Matrices of
+    // up to SMALL_KERNEL_MAX_ROWS rows are dispatched to transformSmall of
+    // avx2-small.h.
     AVXVector transform(const SOAMatrix & matrix,
                         const AVXVector & inputVector) noexcept;
-}
\ No newline at end of file
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication with the
+    // epilogue of the options applied in the last column pass, which stores
+    // the result packs according to the store mode of the options.
+    AVXVector transform(const SOAMatrix & matrix, const AVXVector & inputVector,
+                        const TransformOptions & options) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication into the given
+    // result of R elements, which spares iterative loops the allocation of a
+    // result per call.
+    void transform(const SOAMatrix & matrix, const AVXVector & inputVector,
+                   AVXVector & result) noexcept;
+
+    // Performs a RxC * Cx1 -> Rx1 matrix-vector multiplication with the
+    // options into the given result of R elements.
+    void transform(const SOAMatrix & matrix, const AVXVector & inputVector,
+                   const TransformOptions & options,
+                   AVXVector & result) noexcept;
+
+    // Adds the columns of the matrix from the first column on, times the
+    // elements of the input pack, to the result in the column passes of
+    // transform. So a result accumulated pack by pack equals the one of
+    // transform once the caller restores its padding.
+    void accumulateColumns(const SOAMatrix & matrix, const AVXPack & inputPack,
+                           const std::size_t firstColumn,
+                           AVXVector & result) noexcept;
+}
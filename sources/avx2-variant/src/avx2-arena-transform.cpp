@@ -0,0 +1,48 @@
+#include "avx2-arena-transform.h"
+
+#include "transform-operation.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    void transformArena(const MatrixArena & matrices,
+                        const VectorArena & inputs,
+                        VectorArena & results) noexcept
+    {
+        transformArena(matrices, inputs, results, 0, matrices.size());
+    }
+
+    void transformArena(const MatrixArena & matrices,
+                        const VectorArena & inputs, VectorArena & results,
+                        const size_t first, const size_t last) noexcept
+    {
+        assert(inputs.size() == matrices.size());
+        assert(results.size() == matrices.size());
+        assert(first <= last && last <= matrices.size());
+
+        for (auto m = first; m < last; ++m)
+        {
+            const auto rows = matrices.rows(m);
+            assert(inputs.elements(m) == matrices.columns(m));
+            assert(results.elements(m) == rows);
+
+            auto result = results.packs().data() + results.firstPack(m);
+            transformRegisterBlocked(
+                matrices.packs().data() + matrices.firstPack(m), rows,
+                matrices.columns(m),
+                inputs.packs().data() + inputs.firstPack(m), result);
+
+            // The padding rows of the matrix may have flipped the sign of the
+            // padding in the result.
+            auto & lastPack = result[padSize(rows) - 1];
+            for (auto lane = rows % NUM_FLOATS_PER_AVX_REGISTER;
+                 lane > 0 && lane < NUM_FLOATS_PER_AVX_REGISTER; ++lane)
+            {
+                lastPack[lane] = PADDING_VALUE;
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+#include "avx2-batch.h"
+
+#include <avx2-epilogue.h>
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // The slab of a row tile and a column block stays in the L2 cache
+        // while each group of input vectors sweeps it.
+        constexpr size_t TILE_PACKS{8};
+        constexpr size_t COLUMN_BLOCK{256};
+
+        // Input vectors per group and row packs per sweep, so that their
+        // partial results fit into the AVX registers during the sweep.
+        constexpr size_t INPUT_GROUP{4};
+        constexpr size_t SWEEP_PACKS{2};
+
+        // Sweeps the columns [firstColumn, lastColumn) for PACKS row packs
+        // of INPUTS input vectors, keeping the partial results in registers.
+        template <size_t INPUTS, size_t PACKS>
+        void sweepColumns(const AVXPack * rowPacks,
+                          const size_t packsPerColumn,
+                          const size_t firstColumn, const size_t lastColumn,
+                          const float * const * inputs,
+                          AVXPack * const * results) noexcept
+        {
+            __m256 sums[INPUTS][PACKS];
+            for (size_t i{0}; i < INPUTS; ++i)
+            {
+                for (size_t j{0}; j < PACKS; ++j)
+                {
+                    sums[i][j] = _mm256_load_ps(results[i][j].data());
+                }
+            }
+
+            for (auto c = firstColumn; c < lastColumn; ++c)
+            {
+                const auto column = rowPacks + c * packsPerColumn;
+
+                __m256 partialColumns[PACKS];
+                for (size_t j{0}; j < PACKS; ++j)
+                {
+                    partialColumns[j] = _mm256_load_ps(column[j].data());
+                }
+
+                for (size_t i{0}; i < INPUTS; ++i)
+                {
+                    const auto inputBroadcast =
+                        _mm256_broadcast_ss(inputs[i] + c);
+                    for (size_t j{0}; j < PACKS; ++j)
+                    {
+                        sums[i][j] = _mm256_add_ps(
+                            _mm256_mul_ps(partialColumns[j], inputBroadcast),
+                            sums[i][j]);
+                    }
+                }
+            }
+
+            for (size_t i{0}; i < INPUTS; ++i)
+            {
+                for (size_t j{0}; j < PACKS; ++j)
+                {
+                    _mm256_store_ps(results[i][j].data(), sums[i][j]);
+                }
+            }
+        }
+
+        template <size_t INPUTS>
+        void sweepTile(const SOAMatrix & matrix, const size_t firstPack,
+                       const size_t lastPack, const size_t firstColumn,
+                       const size_t lastColumn, const float * const * inputs,
+                       vector<AVXVector> & resultVectors,
+                       const size_t firstResult) noexcept
+        {
+            const auto packsPerColumn = padSize(matrix.rows());
+
+            AVXPack * results[INPUTS];
+            for (auto p = firstPack; p < lastPack; p += SWEEP_PACKS)
+            {
+                for (size_t i{0}; i < INPUTS; ++i)
+                {
+                    results[i] = &resultVectors[firstResult + i].packs()[p];
+                }
+
+                const auto rowPacks = matrix.packs().data() + p;
+                if (p + SWEEP_PACKS <= lastPack)
+                {
+                    sweepColumns<INPUTS, SWEEP_PACKS>(
+                        rowPacks, packsPerColumn, firstColumn, lastColumn,
+                        inputs, results);
+                }
+                else
+                {
+                    sweepColumns<INPUTS, 1>(rowPacks, packsPerColumn,
+                                            firstColumn, lastColumn, inputs,
+                                            results);
+                }
+            }
+        }
+    }
+
+    vector<AVXVector> transformBatch(
+        const SOAMatrix & matrix,
+        const vector<const AVXVector *> & inputVectors) noexcept
+    {
+        const auto rows = matrix.rows();
+        const auto columns = matrix.columns();
+        const auto packsPerColumn = padSize(rows);
+        const auto count = inputVectors.size();
+
+        // The packs of a vector are contiguous floats.
+        vector<const float *> inputs;
+        vector<AVXVector> resultVectors;
+        inputs.reserve(count);
+        resultVectors.reserve(count);
+        for (auto inputVector : inputVectors)
+        {
+            assert(inputVector->size() == columns);
+            inputs.push_back(inputVector->packs().front().data());
+            resultVectors.emplace_back(rows, 0.0F);
+        }
+
+        // Each slab is loaded from memory once for all inputs, while the
+        // groups of inputs sweep it one after the other.
+        for (size_t firstPack{0}; firstPack < packsPerColumn;
+             firstPack += TILE_PACKS)
+        {
+            const auto lastPack = min(firstPack + TILE_PACKS, packsPerColumn);
+
+            for (size_t firstColumn{0}; firstColumn < columns;
+                 firstColumn += COLUMN_BLOCK)
+            {
+                const auto lastColumn =
+                    min(firstColumn + COLUMN_BLOCK, columns);
+
+                for (size_t b{0}; b < count; b += INPUT_GROUP)
+                {
+                    const auto group = inputs.data() + b;
+                    switch (min(INPUT_GROUP, count - b))
+                    {
+                    case 1:
+                        sweepTile<1>(matrix, firstPack, lastPack, firstColumn,
+                                     lastColumn, group, resultVectors, b);
+                        break;
+                    case 2:
+                        sweepTile<2>(matrix, firstPack, lastPack, firstColumn,
+                                     lastColumn, group, resultVectors, b);
+                        break;
+                    case 3:
+                        sweepTile<3>(matrix, firstPack, lastPack, firstColumn,
+                                     lastColumn, group, resultVectors, b);
+                        break;
+                    default:
+                        sweepTile<INPUT_GROUP>(matrix, firstPack, lastPack,
+                                               firstColumn, lastColumn, group,
+                                               resultVectors, b);
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (auto && resultVector : resultVectors)
+        {
+            restorePadding(resultVector);
+        }
+
+        return resultVectors;
+    }
+}
@@ -0,0 +1,367 @@
+#include "avx2-blas1.h"
+
+#include <avx2-epilogue.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        inline auto load(const AVXPack & pack) noexcept
+        {
+            return _mm256_load_ps(pack.data());
+        }
+
+        inline void store(AVXPack & pack, const __m256 & value) noexcept
+        {
+            _mm256_store_ps(pack.data(), value);
+        }
+
+        inline float horizontalSum(const __m256 & value) noexcept
+        {
+            const auto half = _mm_add_ps(_mm256_castps256_ps128(value),
+                                         _mm256_extractf128_ps(value, 1));
+            const auto quarter = _mm_add_ps(half, _mm_movehl_ps(half, half));
+            return _mm_cvtss_f32(
+                _mm_add_ss(quarter, _mm_shuffle_ps(quarter, quarter, 1)));
+        }
+
+        inline size_t firstPackOf(const size_t block) noexcept
+        {
+            return block * REDUCTION_BLOCK_PACKS;
+        }
+
+        inline size_t lastPackOf(const AVXVector & x,
+                                 const size_t block) noexcept
+        {
+            return min(x.packs().size(), (block + 1) * REDUCTION_BLOCK_PACKS);
+        }
+
+        // Two sums, which std::pair would hold without the alignment of
+        // __m256.
+        struct SumPair
+        {
+            __m256 first;
+            __m256 second;
+        };
+
+        // Sums the terms of the packs [firstPack, lastPack) in four
+        // accumulators, which hide the latency of the additions, and adds
+        // the accumulators pairwise.
+        template <typename Term>
+        inline __m256 sumPacks(const size_t firstPack, const size_t lastPack,
+                               Term && term) noexcept
+        {
+            __m256 sums[]{_mm256_setzero_ps(), _mm256_setzero_ps(),
+                          _mm256_setzero_ps(), _mm256_setzero_ps()};
+            auto p = firstPack;
+            for (; p + 4 <= lastPack; p += 4)
+            {
+                sums[0] = _mm256_add_ps(term(p), sums[0]);
+                sums[1] = _mm256_add_ps(term(p + 1), sums[1]);
+                sums[2] = _mm256_add_ps(term(p + 2), sums[2]);
+                sums[3] = _mm256_add_ps(term(p + 3), sums[3]);
+            }
+            for (; p < lastPack; ++p)
+            {
+                sums[0] = _mm256_add_ps(term(p), sums[0]);
+            }
+            return _mm256_add_ps(_mm256_add_ps(sums[0], sums[1]),
+                                 _mm256_add_ps(sums[2], sums[3]));
+        }
+
+        // Like sumPacks for two sums over the same packs, with the term
+        // returning the terms of both.
+        template <typename Terms>
+        inline SumPair sumPacksTwice(const size_t firstPack,
+                                     const size_t lastPack,
+                                     Terms && terms) noexcept
+        {
+            __m256 firstSums[]{_mm256_setzero_ps(), _mm256_setzero_ps()};
+            __m256 secondSums[]{_mm256_setzero_ps(), _mm256_setzero_ps()};
+            auto p = firstPack;
+            for (; p + 2 <= lastPack; p += 2)
+            {
+                const auto [first0, second0] = terms(p);
+                const auto [first1, second1] = terms(p + 1);
+                firstSums[0] = _mm256_add_ps(first0, firstSums[0]);
+                secondSums[0] = _mm256_add_ps(second0, secondSums[0]);
+                firstSums[1] = _mm256_add_ps(first1, firstSums[1]);
+                secondSums[1] = _mm256_add_ps(second1, secondSums[1]);
+            }
+            for (; p < lastPack; ++p)
+            {
+                const auto [first, second] = terms(p);
+                firstSums[0] = _mm256_add_ps(first, firstSums[0]);
+                secondSums[0] = _mm256_add_ps(second, secondSums[0]);
+            }
+            return {_mm256_add_ps(firstSums[0], firstSums[1]),
+                    _mm256_add_ps(secondSums[0], secondSums[1])};
+        }
+
+        inline __m256 dotBlock(const AVXVector & x, const AVXVector & y,
+                               const size_t block) noexcept
+        {
+            return sumPacks(
+                firstPackOf(block), lastPackOf(x, block), [&](const size_t p) {
+                    return _mm256_mul_ps(load(x.packs()[p]),
+                                         load(y.packs()[p]));
+                });
+        }
+
+        inline SumPair dotAndSquaredNormBlock(const AVXVector & x,
+                                              const AVXVector & y,
+                                              const size_t block) noexcept
+        {
+            return sumPacksTwice(
+                firstPackOf(block), lastPackOf(x, block), [&](const size_t p) {
+                    const auto yPack = load(y.packs()[p]);
+                    return SumPair{_mm256_mul_ps(load(x.packs()[p]), yPack),
+                                   _mm256_mul_ps(yPack, yPack)};
+                });
+        }
+
+        inline __m256 axpbyAndSquaredNormBlock(const float alpha,
+                                               const AVXVector & x,
+                                               const float beta,
+                                               AVXVector & y,
+                                               const size_t block) noexcept
+        {
+            const auto alphaBroadcast = _mm256_set1_ps(alpha);
+            const auto betaBroadcast = _mm256_set1_ps(beta);
+            return sumPacks(
+                firstPackOf(block), lastPackOf(x, block), [&](const size_t p) {
+                    const auto yPack = _mm256_add_ps(
+                        _mm256_mul_ps(load(x.packs()[p]), alphaBroadcast),
+                        _mm256_mul_ps(load(y.packs()[p]), betaBroadcast));
+                    store(y.packs()[p], yPack);
+                    return _mm256_mul_ps(yPack, yPack);
+                });
+        }
+
+        // Adds the partial sums of all blocks in their order like
+        // sumPartials, but without storing them.
+        template <typename BlockSum>
+        inline float reduce(const AVXVector & x, BlockSum && blockSum) noexcept
+        {
+            auto total = _mm256_setzero_ps();
+            for (size_t b{0}; b < reductionBlocks(x); ++b)
+            {
+                total = _mm256_add_ps(total, blockSum(b));
+            }
+            return horizontalSum(total);
+        }
+    }
+
+    size_t reductionBlocks(const AVXVector & x) noexcept
+    {
+        return (x.packs().size() + REDUCTION_BLOCK_PACKS - 1) /
+               REDUCTION_BLOCK_PACKS;
+    }
+
+    float sumPartials(const AVXPack * partials, const size_t blocks) noexcept
+    {
+        auto total = _mm256_setzero_ps();
+        for (size_t b{0}; b < blocks; ++b)
+        {
+            total = _mm256_add_ps(total, load(partials[b]));
+        }
+        return horizontalSum(total);
+    }
+
+    float dot(const AVXVector & x, const AVXVector & y) noexcept
+    {
+        assert(x.size() == y.size());
+
+        return reduce(x, [&](const size_t b) { return dotBlock(x, y, b); });
+    }
+
+    float squaredNorm(const AVXVector & x) noexcept
+    {
+        return dot(x, x);
+    }
+
+    float norm(const AVXVector & x) noexcept
+    {
+        return sqrt(squaredNorm(x));
+    }
+
+    pair<float, float> dotAndSquaredNorm(const AVXVector & x,
+                                         const AVXVector & y) noexcept
+    {
+        assert(x.size() == y.size());
+
+        auto dotTotal = _mm256_setzero_ps();
+        auto squaredNormTotal = _mm256_setzero_ps();
+        for (size_t b{0}; b < reductionBlocks(x); ++b)
+        {
+            const auto [dotSum, squaredNormSum] =
+                dotAndSquaredNormBlock(x, y, b);
+            dotTotal = _mm256_add_ps(dotTotal, dotSum);
+            squaredNormTotal = _mm256_add_ps(squaredNormTotal, squaredNormSum);
+        }
+        return {horizontalSum(dotTotal), horizontalSum(squaredNormTotal)};
+    }
+
+    void scale(const float alpha, AVXVector & x) noexcept
+    {
+        scale(alpha, x, 0, x.packs().size());
+        restorePadding(x);
+    }
+
+    void axpy(const float alpha, const AVXVector & x, AVXVector & y) noexcept
+    {
+        axpby(alpha, x, 1.0F, y);
+    }
+
+    void axpby(const float alpha, const AVXVector & x, const float beta,
+               AVXVector & y) noexcept
+    {
+        axpby(alpha, x, beta, y, 0, y.packs().size());
+        restorePadding(y);
+    }
+
+    float axpbyAndSquaredNorm(const float alpha, const AVXVector & x,
+                              const float beta, AVXVector & y) noexcept
+    {
+        assert(x.size() == y.size());
+
+        const auto result = reduce(x, [&](const size_t b) {
+            return axpbyAndSquaredNormBlock(alpha, x, beta, y, b);
+        });
+        restorePadding(y);
+        return result;
+    }
+
+    void add(const AVXVector & x, const AVXVector & y,
+             AVXVector & result) noexcept
+    {
+        add(x, y, result, 0, result.packs().size());
+        restorePadding(result);
+    }
+
+    void multiplyElementwise(const AVXVector & x, const AVXVector & y,
+                             AVXVector & result) noexcept
+    {
+        multiplyElementwise(x, y, result, 0, result.packs().size());
+        restorePadding(result);
+    }
+
+    void dot(const AVXVector & x, const AVXVector & y, const size_t firstBlock,
+             const size_t lastBlock, AVXPack * partials) noexcept
+    {
+        assert(x.size() == y.size());
+        assert(lastBlock <= reductionBlocks(x));
+
+        for (auto b = firstBlock; b < lastBlock; ++b)
+        {
+            store(partials[b], dotBlock(x, y, b));
+        }
+    }
+
+    void squaredNorm(const AVXVector & x, const size_t firstBlock,
+                     const size_t lastBlock, AVXPack * partials) noexcept
+    {
+        dot(x, x, firstBlock, lastBlock, partials);
+    }
+
+    void dotAndSquaredNorm(const AVXVector & x, const AVXVector & y,
+                           const size_t firstBlock, const size_t lastBlock,
+                           AVXPack * dotPartials,
+                           AVXPack * squaredNormPartials) noexcept
+    {
+        assert(x.size() == y.size());
+        assert(lastBlock <= reductionBlocks(x));
+
+        for (auto b = firstBlock; b < lastBlock; ++b)
+        {
+            const auto [dotSum, squaredNormSum] =
+                dotAndSquaredNormBlock(x, y, b);
+            store(dotPartials[b], dotSum);
+            store(squaredNormPartials[b], squaredNormSum);
+        }
+    }
+
+    void axpbyAndSquaredNorm(const float alpha, const AVXVector & x,
+                             const float beta, AVXVector & y,
+                             const size_t firstBlock, const size_t lastBlock,
+                             AVXPack * partials) noexcept
+    {
+        assert(x.size() == y.size());
+        assert(lastBlock <= reductionBlocks(x));
+
+        for (auto b = firstBlock; b < lastBlock; ++b)
+        {
+            store(partials[b], axpbyAndSquaredNormBlock(alpha, x, beta, y, b));
+        }
+    }
+
+    void scale(const float alpha, AVXVector & x, const size_t firstPack,
+               const size_t lastPack) noexcept
+    {
+        assert(lastPack <= x.packs().size());
+
+        const auto alphaBroadcast = _mm256_set1_ps(alpha);
+        for (auto p = firstPack; p < lastPack; ++p)
+        {
+            store(x.packs()[p],
+                  _mm256_mul_ps(load(x.packs()[p]), alphaBroadcast));
+        }
+    }
+
+    void axpby(const float alpha, const AVXVector & x, const float beta,
+               AVXVector & y, const size_t firstPack,
+               const size_t lastPack) noexcept
+    {
+        assert(x.size() == y.size());
+        assert(lastPack <= y.packs().size());
+
+        const auto alphaBroadcast = _mm256_set1_ps(alpha);
+        const auto betaBroadcast = _mm256_set1_ps(beta);
+        for (auto p = firstPack; p < lastPack; ++p)
+        {
+            store(y.packs()[p],
+                  _mm256_add_ps(
+                      _mm256_mul_ps(load(x.packs()[p]), alphaBroadcast),
+                      _mm256_mul_ps(load(y.packs()[p]), betaBroadcast)));
+        }
+    }
+
+    void add(const AVXVector & x, const AVXVector & y, AVXVector & result,
+             const size_t firstPack, const size_t lastPack) noexcept
+    {
+        assert(x.size() == y.size() && x.size() == result.size());
+        assert(lastPack <= result.packs().size());
+
+        for (auto p = firstPack; p < lastPack; ++p)
+        {
+            store(result.packs()[p],
+                  _mm256_add_ps(load(x.packs()[p]), load(y.packs()[p])));
+        }
+    }
+
+    void multiplyElementwise(const AVXVector & x, const AVXVector & y,
+                             AVXVector & result, const size_t firstPack,
+                             const size_t lastPack) noexcept
+    {
+        assert(x.size() == y.size() && x.size() == result.size());
+        assert(lastPack <= result.packs().size());
+
+        for (auto p = firstPack; p < lastPack; ++p)
+        {
+            store(result.packs()[p],
+                  _mm256_mul_ps(load(x.packs()[p]), load(y.packs()[p])));
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include "avx2-chain.h"
+
+#include "transform-operation.h"
+
+#include <host-info.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        size_t widestLayer(const vector<ChainLayer> & layers) noexcept
+        {
+            assert(!layers.empty());
+
+            size_t widest{0};
+            for (auto && layer : layers)
+            {
+                widest = max(widest, layer.matrix->rows());
+            }
+            return widest;
+        }
+
+        // Prepares a ping-pong buffer for accumulating the result of a layer.
+        void clearForAccumulation(AVXVector & buffer,
+                                  const size_t rows) noexcept
+        {
+            buffer.resize(rows);
+
+            for (auto && pack : buffer.packs())
+            {
+                _mm256_store_ps(pack.data(), _mm256_setzero_ps());
+            }
+        }
+
+        auto inputBroadcast(const AVXVector & inputVector,
+                            const size_t column) noexcept
+        {
+            const auto & inputPack =
+                inputVector.packs()[column / NUM_FLOATS_PER_AVX_REGISTER];
+            return _mm256_broadcast_ss(
+                &inputPack[column % NUM_FLOATS_PER_AVX_REGISTER]);
+        }
+
+        // Performs the column passes in [begin, end) of a layer.
+        void accumulateColumns(const ChainLayer & layer,
+                               const AVXVector & inputVector,
+                               const size_t begin, const size_t end,
+                               AVXVector & resultVector) noexcept
+        {
+            const TransformOperation transformOp{layer.matrix->rows(),
+                                                 layer.matrix->packs().cbegin(),
+                                                 resultVector};
+
+            for (auto c = begin; c < end; ++c)
+            {
+                transformOp(c, inputBroadcast(inputVector, c));
+            }
+        }
+
+        // Performs the last column pass of a layer with its epilogue. The
+        // results are consumed right away by the next layer, so they are
+        // always cached.
+        template <typename PackConsumer>
+        void finalizeLayer(const ChainLayer & layer, const float lastInput,
+                           AVXVector & resultVector,
+                           PackConsumer && consumer) noexcept
+        {
+            const auto & matrix = *layer.matrix;
+            const TransformOperation transformOp{
+                matrix.rows(), matrix.packs().cbegin(), resultVector};
+
+            transformOp(matrix.columns() - 1, _mm256_set1_ps(lastInput),
+                        EpilogueOperation{layer.epilogue}, false, consumer);
+        }
+    }
+
+    TransformChain::TransformChain(vector<ChainLayer> layers) noexcept
+        : TransformChain(std::move(layers), host::cacheSizes().l2)
+    {
+    }
+
+    TransformChain::TransformChain(vector<ChainLayer> layers,
+                                   const size_t fusionBudget) noexcept
+        : _layers(std::move(layers)), _fusionBudget{fusionBudget},
+          _ping(widestLayer(_layers)), _pong(widestLayer(_layers))
+    {
+        for (size_t i{0}; i < this->_layers.size(); ++i)
+        {
+            [[maybe_unused]] const auto & layer = this->_layers[i];
+
+            assert(layer.matrix != nullptr);
+            assert(layer.epilogue.bias == nullptr ||
+                   layer.epilogue.bias->size() == layer.matrix->rows());
+            assert(i == 0 || layer.matrix->columns() ==
+                                 this->_layers[i - 1].matrix->rows());
+        }
+    }
+
+    bool TransformChain::isFused(const size_t layer) const noexcept
+    {
+        if (layer + 1 >= this->_layers.size())
+        {
+            return false;
+        }
+
+        const auto producedPacks = padSize(this->_layers[layer].matrix->rows());
+        const auto consumedPacks =
+            padSize(this->_layers[layer + 1].matrix->rows());
+        return (producedPacks + consumedPacks) * sizeof(AVXPack) <=
+               this->_fusionBudget;
+    }
+
+    const AVXVector & TransformChain::operator()(
+        const AVXVector & inputVector) noexcept
+    {
+        assert(inputVector.size() == this->_layers.front().matrix->columns());
+
+        const AVXVector * input = &inputVector;
+        AVXVector * output = &this->_ping;
+        AVXVector * spare = &this->_pong;
+
+        // The last column pass of each layer is delayed until the next loop
+        // iteration, so that the epilogue can be fused into it.
+        const auto & firstMatrix = *this->_layers.front().matrix;
+        clearForAccumulation(*output, firstMatrix.rows());
+        accumulateColumns(this->_layers.front(), *input, 0,
+                          firstMatrix.columns() - 1, *output);
+
+        for (size_t i{0}; i < this->_layers.size(); ++i)
+        {
+            const auto & layer = this->_layers[i];
+
+            // The spare buffer may still hold the input of this layer, so we
+            // must fetch its last element before reusing the buffer.
+            const auto lastInput = input->at(layer.matrix->columns() - 1);
+
+            if (this->isFused(i))
+            {
+                const auto & nextLayer = this->_layers[i + 1];
+                const auto nextColumns = nextLayer.matrix->columns();
+                clearForAccumulation(*spare, nextLayer.matrix->rows());
+
+                const TransformOperation nextTransformOp{
+                    nextLayer.matrix->rows(),
+                    nextLayer.matrix->packs().cbegin(), *spare};
+
+                // Every finalized pack of this layer provides the inputs of
+                // the next NUM_FLOATS_PER_AVX_REGISTER column passes of the
+                // next layer while the pack is still in the L1 cache.
+                finalizeLayer(layer, lastInput, *output, [&](const size_t p) {
+                    const auto begin = p * NUM_FLOATS_PER_AVX_REGISTER;
+                    const auto end = min(begin + NUM_FLOATS_PER_AVX_REGISTER,
+                                         nextColumns - 1);
+                    for (auto c = begin; c < end; ++c)
+                    {
+                        nextTransformOp(c, inputBroadcast(*output, c));
+                    }
+                });
+            }
+            else
+            {
+                finalizeLayer(layer, lastInput, *output, [](const size_t) {});
+
+                if (i + 1 < this->_layers.size())
+                {
+                    const auto & nextLayer = this->_layers[i + 1];
+                    clearForAccumulation(*spare, nextLayer.matrix->rows());
+                    accumulateColumns(nextLayer, *output, 0,
+                                      nextLayer.matrix->columns() - 1, *spare);
+                }
+            }
+
+            input = output;
+            swap(output, spare);
+        }
+
+        return *input;
+    }
+}
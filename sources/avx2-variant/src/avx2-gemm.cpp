@@ -0,0 +1,270 @@
+#include "avx2-gemm.h"
+
+#include "transform-operation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // The micro-kernel computes a tile of 2 packs (16 rows) by 6 columns
+        // of the result, which takes 12 of the 16 AVX registers for the
+        // partial results, 2 for the packs of A and 1 for the broadcast
+        // element of B.
+        constexpr size_t TILE_PACKS{2};
+        constexpr size_t TILE_COLUMNS{GEMM_TILE_COLUMNS};
+
+        // Besides the blocking of avx2-gemm.h, a KC deep panel of B of the
+        // width of one tile (6KB) stays in the L1 cache.
+        constexpr size_t KC{GEMM_PANEL_DEPTH};
+        constexpr size_t MC_PACKS{GEMM_BLOCK_PACKS};
+        constexpr size_t NC{GEMM_PANEL_COLUMNS};
+
+        static_assert(MC_PACKS % TILE_PACKS == 0);
+        static_assert(NC % TILE_COLUMNS == 0);
+
+        // Copies the block of A of the row packs [firstPack, firstPack +
+        // packs) and the columns [firstColumn, firstColumn + depth) into
+        // strips of TILE_PACKS packs. Each strip holds its packs column by
+        // column, so that the micro-kernel reads it sequentially. Missing
+        // packs of the last strip are zero.
+        void packA(const SOAMatrix & a, const size_t firstPack,
+                   const size_t packs, const size_t firstColumn,
+                   const size_t depth, vector<AVXPack> & packedA) noexcept
+        {
+            const auto packsPerColumn = padSize(a.rows());
+            auto packed = packedA.begin();
+            for (size_t strip{0}; strip < packs; strip += TILE_PACKS)
+            {
+                for (size_t k{0}; k < depth; ++k)
+                {
+                    const auto column =
+                        a.packs().cbegin() +
+                        static_cast<int64_t>((firstColumn + k) *
+                                                 packsPerColumn +
+                                             firstPack + strip);
+                    for (size_t p{0}; p < TILE_PACKS; ++p)
+                    {
+                        const auto value =
+                            strip + p < packs
+                                ? _mm256_load_ps((column + p)->data())
+                                : _mm256_setzero_ps();
+                        _mm256_store_ps(packed->data(), value);
+                        ++packed;
+                    }
+                }
+            }
+        }
+
+        // Copies the tiles [firstTile, lastTile) of the block of B of the
+        // rows [firstRow, firstRow + depth) and the columns [firstColumn,
+        // firstColumn + width) into panels of TILE_COLUMNS columns. Each
+        // panel holds its elements row by row, so that the micro-kernel
+        // broadcasts them sequentially. Missing columns of the last panel
+        // are zero.
+        void packB(const SOAMatrix & b, const size_t firstRow,
+                   const size_t depth, const size_t firstColumn,
+                   const size_t width, const size_t firstTile,
+                   const size_t lastTile, vector<float> & packedB) noexcept
+        {
+            const auto packsPerColumn = padSize(b.rows());
+            for (auto panel = firstTile * TILE_COLUMNS;
+                 panel < min(width, lastTile * TILE_COLUMNS);
+                 panel += TILE_COLUMNS)
+            {
+                auto packed = packedB.begin() +
+                              static_cast<int64_t>(panel * depth);
+                for (size_t j{0}; j < TILE_COLUMNS; ++j)
+                {
+                    const auto column = firstColumn + panel + j;
+                    for (size_t k{0}; k < depth; ++k)
+                    {
+                        const auto row = firstRow + k;
+                        packed[static_cast<int64_t>(k * TILE_COLUMNS + j)] =
+                            panel + j < width
+                                ? b.packs()[column * packsPerColumn +
+                                            row / NUM_FLOATS_PER_AVX_REGISTER]
+                                           [row % NUM_FLOATS_PER_AVX_REGISTER]
+                                : 0.0F;
+                    }
+                }
+            }
+        }
+
+        // Multiplies a strip of packed A with a panel of packed B and stores
+        // the tile of partial results.
+        void microKernel(const size_t depth, const AVXPack * packedA,
+                         const float * packedB, AVXPack * tile) noexcept
+        {
+            __m256 sums[TILE_PACKS][TILE_COLUMNS];
+            for (size_t p{0}; p < TILE_PACKS; ++p)
+            {
+                for (size_t j{0}; j < TILE_COLUMNS; ++j)
+                {
+                    sums[p][j] = _mm256_setzero_ps();
+                }
+            }
+
+            for (size_t k{0}; k < depth; ++k)
+            {
+                const auto a0 = _mm256_load_ps(packedA[0].data());
+                const auto a1 = _mm256_load_ps(packedA[1].data());
+                for (size_t j{0}; j < TILE_COLUMNS; ++j)
+                {
+                    const auto bBroadcast = _mm256_broadcast_ss(packedB + j);
+                    sums[0][j] = multiplyAdd(a0, bBroadcast, sums[0][j]);
+                    sums[1][j] = multiplyAdd(a1, bBroadcast, sums[1][j]);
+                }
+                packedA += TILE_PACKS;
+                packedB += TILE_COLUMNS;
+            }
+
+            for (size_t j{0}; j < TILE_COLUMNS; ++j)
+            {
+                for (size_t p{0}; p < TILE_PACKS; ++p)
+                {
+                    _mm256_store_ps(tile[j * TILE_PACKS + p].data(),
+                                    sums[p][j]);
+                }
+            }
+        }
+
+        // Adds the valid packs and columns of the tile to the result.
+        void addTile(const AVXPack * tile, SOAMatrix & result,
+                     const size_t firstPack, const size_t packs,
+                     const size_t firstColumn, const size_t columns) noexcept
+        {
+            const auto packsPerColumn = padSize(result.rows());
+            for (size_t j{0}; j < columns; ++j)
+            {
+                auto resultPack =
+                    result.packs().begin() +
+                    static_cast<int64_t>((firstColumn + j) * packsPerColumn +
+                                         firstPack);
+                for (size_t p{0}; p < packs; ++p)
+                {
+                    const auto sum = _mm256_add_ps(
+                        _mm256_load_ps(resultPack->data()),
+                        _mm256_load_ps(tile[j * TILE_PACKS + p].data()));
+                    _mm256_store_ps(resultPack->data(), sum);
+                    ++resultPack;
+                }
+            }
+        }
+    }
+
+    SOAMatrix multiply(const SOAMatrix & a, const SOAMatrix & b) noexcept
+    {
+        SOAMatrix result{a.rows(), b.columns()};
+        multiply(a, b, result, 0, b.columns());
+        return result;
+    }
+
+    void multiply(const SOAMatrix & a, const SOAMatrix & b, SOAMatrix & result,
+                  const size_t firstColumn, const size_t lastColumn) noexcept
+    {
+        assert(a.columns() == b.rows());
+        assert(result.rows() == a.rows() && result.columns() == b.columns());
+        assert(firstColumn <= lastColumn && lastColumn <= b.columns());
+
+        const auto packsPerColumn = padSize(a.rows());
+        const auto inner = a.columns();
+
+        // The range is computed from scratch.
+        for (auto c = firstColumn; c < lastColumn; ++c)
+        {
+            fill_n(result.packs().begin() +
+                       static_cast<int64_t>(c * packsPerColumn),
+                   packsPerColumn, AVXPack{});
+        }
+
+        vector<AVXPack> packedA(MC_PACKS * KC);
+        vector<float> packedB(NC * KC);
+
+        for (auto jc = firstColumn; jc < lastColumn; jc += NC)
+        {
+            const auto width = min(NC, lastColumn - jc);
+            for (size_t pc{0}; pc < inner; pc += KC)
+            {
+                const GemmPanel panel{pc, min(KC, inner - pc), jc, width};
+                packGemmPanel(b, panel, 0, panel.tiles(), packedB);
+
+                for (size_t ic{0}; ic < packsPerColumn; ic += MC_PACKS)
+                {
+                    multiplyGemmBlock(a, panel, packedB, ic,
+                                      min(MC_PACKS, packsPerColumn - ic), 0,
+                                      panel.tiles(), packedA, result);
+                }
+            }
+        }
+
+        restoreGemmPadding(result, firstColumn, lastColumn);
+    }
+
+    void packGemmPanel(const SOAMatrix & b, const GemmPanel & panel,
+                       const size_t firstTile, const size_t lastTile,
+                       vector<float> & packedB) noexcept
+    {
+        assert(panel.depth <= KC && panel.width <= NC);
+        assert(packedB.size() >= NC * KC);
+
+        packB(b, panel.firstRow, panel.depth, panel.firstColumn, panel.width,
+              firstTile, lastTile, packedB);
+    }
+
+    void multiplyGemmBlock(const SOAMatrix & a, const GemmPanel & panel,
+                           const vector<float> & packedB,
+                           const size_t firstPack, const size_t packs,
+                           const size_t firstTile, const size_t lastTile,
+                           vector<AVXPack> & packedA,
+                           SOAMatrix & result) noexcept
+    {
+        assert(packs <= MC_PACKS);
+        assert(packedA.size() >= MC_PACKS * KC);
+
+        const auto depth = panel.depth;
+        packA(a, firstPack, packs, panel.firstRow, depth, packedA);
+
+        AVXPack tile[TILE_PACKS * TILE_COLUMNS];
+        for (auto jr = firstTile * TILE_COLUMNS;
+             jr < min(panel.width, lastTile * TILE_COLUMNS); jr += TILE_COLUMNS)
+        {
+            const auto columns = min(TILE_COLUMNS, panel.width - jr);
+            for (size_t ir{0}; ir < packs; ir += TILE_PACKS)
+            {
+                microKernel(depth, packedA.data() + ir * depth,
+                            packedB.data() + jr * depth, tile);
+                addTile(tile, result, firstPack + ir,
+                        min(TILE_PACKS, packs - ir), panel.firstColumn + jr,
+                        columns);
+            }
+        }
+    }
+
+    void restoreGemmPadding(SOAMatrix & result, const size_t firstColumn,
+                            const size_t lastColumn) noexcept
+    {
+        const auto packsPerColumn = padSize(result.rows());
+        const auto firstPaddingLane =
+            result.rows() % NUM_FLOATS_PER_AVX_REGISTER;
+        if (firstPaddingLane == 0)
+        {
+            return;
+        }
+
+        for (auto c = firstColumn; c < lastColumn; ++c)
+        {
+            auto & lastPack = result.packs()[(c + 1) * packsPerColumn - 1];
+            for (auto lane = firstPaddingLane;
+                 lane < NUM_FLOATS_PER_AVX_REGISTER; ++lane)
+            {
+                lastPack[lane] = PADDING_VALUE;
+            }
+        }
+    }
+}
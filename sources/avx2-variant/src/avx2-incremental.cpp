@@ -0,0 +1,90 @@
+#include "avx2-incremental.h"
+#include "avx2-variant.h"
+
+#include "transform-operation.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    IncrementalTransform::IncrementalTransform(
+        const SOAMatrix & matrix, const AVXVector & inputVector,
+        const IncrementalOptions & options) noexcept
+        : _matrix(matrix), _options(options), _input(inputVector),
+          _result(transform(matrix, inputVector))
+    {
+        assert(inputVector.size() == matrix.columns());
+    }
+
+    void IncrementalTransform::recompute() noexcept
+    {
+        this->_result = transform(this->_matrix, this->_input);
+        this->_updatesSinceRefresh = 0;
+        ++this->_stats.fullRecomputes;
+    }
+
+    const AVXVector & IncrementalTransform::update(
+        const vector<InputChange> & changes) noexcept
+    {
+        const auto columns = this->_matrix.columns();
+        const auto fullRecompute =
+            static_cast<double>(changes.size()) >
+                this->_options.fullRecomputeFraction *
+                    static_cast<double>(columns) ||
+            this->_updatesSinceRefresh + 1 >= this->_options.refreshInterval;
+
+        if (fullRecompute)
+        {
+            for (auto && change : changes)
+            {
+                assert(change.index < columns);
+                this->_input.at(change.index) = change.value;
+            }
+
+            this->recompute();
+            return this->_result;
+        }
+
+        // The column step of the transformation, with the difference to the
+        // previous input value as broadcast element.
+        const TransformOperation transformOp{this->_matrix.rows(),
+                                             this->_matrix.packs().cbegin(),
+                                             this->_result};
+        for (auto && change : changes)
+        {
+            assert(change.index < columns);
+
+            auto & inputValue = this->_input.at(change.index);
+            const auto difference = change.value - inputValue;
+            inputValue = change.value;
+
+            if (difference != 0.0F)
+            {
+                transformOp(change.index, _mm256_set1_ps(difference));
+            }
+        }
+
+        restorePadding(this->_result);
+
+        ++this->_updatesSinceRefresh;
+        ++this->_stats.incrementalUpdates;
+        return this->_result;
+    }
+
+    const AVXVector & IncrementalTransform::input() const noexcept
+    {
+        return this->_input;
+    }
+
+    const AVXVector & IncrementalTransform::result() const noexcept
+    {
+        return this->_result;
+    }
+
+    IncrementalStats IncrementalTransform::stats() const noexcept
+    {
+        return this->_stats;
+    }
+}
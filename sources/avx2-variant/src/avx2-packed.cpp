@@ -0,0 +1,88 @@
+#include "avx2-packed.h"
+
+#include "transform-operation.h"
+
+#include <avx2-epilogue.h>
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    static_assert(PACKED_MAX_ROW_PANEL_PACKS == REGISTER_BLOCK_MAX_PACKS,
+                  "a row panel must fit the register block kernels");
+
+    AVXVector transformPacked(const PackedMatrix & matrix,
+                              const AVXVector & inputVector) noexcept
+    {
+        AVXVector resultVector{matrix.rows()};
+        transformPacked(matrix, inputVector, resultVector);
+        return resultVector;
+    }
+
+    void transformPacked(const PackedMatrix & matrix,
+                         const AVXVector & inputVector,
+                         AVXVector & resultVector) noexcept
+    {
+        transformPacked(matrix, inputVector, resultVector, 0,
+                        matrix.rowPanels());
+        restorePadding(resultVector);
+    }
+
+    void transformPacked(const PackedMatrix & matrix,
+                         const AVXVector & inputVector,
+                         AVXVector & resultVector, const size_t firstRowPanel,
+                         const size_t lastRowPanel) noexcept
+    {
+        assert(inputVector.size() == matrix.columns());
+        assert(resultVector.size() == matrix.rows());
+        assert(lastRowPanel <= matrix.rowPanels());
+
+        const auto packsPerColumn = padSize(matrix.rows());
+        const auto panelColumns = matrix.blocking().columnPanelColumns;
+        const auto panelPacks = matrix.blocking().rowPanelPacks;
+        const auto matrixPacks = matrix.packs().data();
+        const auto resultPacks = resultVector.packs().data();
+
+        for (size_t cp{0}; cp < matrix.columnPanels(); ++cp)
+        {
+            const auto firstColumn = cp * panelColumns;
+            const auto columns =
+                min(panelColumns, matrix.columns() - firstColumn);
+            const auto input = inputVector.packs().data() +
+                               firstColumn / NUM_FLOATS_PER_AVX_REGISTER;
+
+            // The row panels of a column panel follow each other, so that
+            // the kernel reads on where the previous one stopped.
+            auto panel = matrixPacks + matrix.firstPack(cp, firstRowPanel);
+            for (auto rp = firstRowPanel; rp < lastRowPanel; ++rp)
+            {
+                const auto firstPack = rp * panelPacks;
+                const auto packs = min(panelPacks, packsPerColumn - firstPack);
+                const auto kernel = REGISTER_BLOCK_KERNELS[packs - 1];
+                if (cp == 0)
+                {
+                    kernel(panel, packs, input, columns,
+                           resultPacks + firstPack);
+                }
+                else
+                {
+                    AVXPack partialResult[REGISTER_BLOCK_MAX_PACKS];
+                    kernel(panel, packs, input, columns, partialResult);
+                    for (size_t p{0}; p < packs; ++p)
+                    {
+                        const auto resultData =
+                            resultPacks[firstPack + p].data();
+                        _mm256_store_ps(
+                            resultData,
+                            _mm256_add_ps(
+                                _mm256_load_ps(resultData),
+                                _mm256_load_ps(partialResult[p].data())));
+                    }
+                }
+                panel += packs * columns;
+            }
+        }
+    }
+}
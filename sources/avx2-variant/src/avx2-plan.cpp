@@ -0,0 +1,300 @@
+#include "avx2-plan.h"
+
+#include "avx2-small.h"
+#include "transform-operation.h"
+
+#include <cassert>
+#include <limits>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // Whether the epilogue leaves the result unchanged, so that a kernel
+        // may skip it.
+        bool isIdentity(const Epilogue & epilogue) noexcept
+        {
+            return epilogue.scale == 1.0F && epilogue.bias == nullptr &&
+                   epilogue.lowerBound ==
+                       -numeric_limits<float>::infinity() &&
+                   epilogue.upperBound == numeric_limits<float>::infinity();
+        }
+
+        // Sweeps the columns over the result packs [firstPack, lastPack) in
+        // the order of TransformOperation and fuses the epilogue into the
+        // pass of the last column. The loops run over counts fixed by the
+        // plan, so that there are no tail conditions.
+        template <bool PREFETCH>
+        void sweepColumns(const AVXPack * matrix,
+                          const size_t packsPerColumn, const size_t columns,
+                          const AVXPack * input, const size_t firstPack,
+                          const size_t lastPack,
+                          const EpilogueOperation & epilogueOp,
+                          const bool streamingStores,
+                          const size_t prefetchDistance,
+                          AVXPack * result) noexcept
+        {
+            for (auto p = firstPack; p < lastPack; ++p)
+            {
+                _mm256_store_ps(result[p].data(), _mm256_setzero_ps());
+            }
+
+            const auto inputBroadcast = [input](const size_t c) {
+                return _mm256_broadcast_ss(
+                    &input[c / NUM_FLOATS_PER_AVX_REGISTER]
+                          [c % NUM_FLOATS_PER_AVX_REGISTER]);
+            };
+
+            // The packs following a segment in its column belong to the
+            // segment of another thread, so that the prefetches stay in the
+            // segment: they target the same packs as many columns ahead as
+            // the distance spans segments, but at least one.
+            const auto segmentLength = lastPack - firstPack;
+            const auto prefetchPacks =
+                (prefetchDistance + segmentLength - 1) / segmentLength *
+                packsPerColumn;
+
+            const auto * column = matrix;
+            const auto lastColumn = columns - 1;
+            for (size_t c{0}; c < lastColumn; ++c)
+            {
+                const auto broadcastInput = inputBroadcast(c);
+                for (auto p = firstPack; p < lastPack; ++p)
+                {
+                    if constexpr (PREFETCH)
+                    {
+                        prefetchAhead(column[p], prefetchPacks);
+                    }
+
+                    _mm256_store_ps(
+                        result[p].data(),
+                        multiplyAdd(_mm256_load_ps(column[p].data()),
+                                    broadcastInput,
+                                    _mm256_load_ps(result[p].data())));
+                }
+                column += packsPerColumn;
+            }
+
+            const auto broadcastInput = inputBroadcast(lastColumn);
+            for (auto p = firstPack; p < lastPack; ++p)
+            {
+                const auto sum =
+                    multiplyAdd(_mm256_load_ps(column[p].data()),
+                                broadcastInput,
+                                _mm256_load_ps(result[p].data()));
+                storeResult(result[p].data(), epilogueOp(sum, p),
+                            streamingStores);
+            }
+        }
+    }
+
+    TransformPlan::TransformPlan(const size_t rows, const size_t columns,
+                                 const PlanOptions & options) noexcept
+        : _rows{rows}, _columns{columns}, _packsPerColumn{padSize(rows)},
+          _threads{options.threads}, _kernel{options.kernel},
+          _epilogueOp{options.transform.epilogue},
+          _streamingStores{
+              usesStreamingStores(options.transform.storeMode, rows)},
+          _prefetchDistance{options.transform.prefetchDistance},
+          _segmentKernel{nullptr}
+    {
+        assert(rows > 0);
+        assert(columns > 0);
+        assert(options.threads > 0);
+        assert(options.transform.epilogue.bias == nullptr ||
+               options.transform.epilogue.bias->size() == rows);
+
+        if (this->_kernel == PlanKernel::AUTOMATIC)
+        {
+            this->_kernel = rows <= SMALL_KERNEL_MAX_ROWS
+                                ? PlanKernel::REGISTER_BLOCKED
+                                : PlanKernel::COLUMN_PASSES;
+        }
+
+        // Each thread gets one contiguous range of the result packs. The
+        // register-blocked kernel splits it into register blocks, which the
+        // threads get as whole blocks.
+        const auto threads = this->_threads;
+        const auto packs = this->_packsPerColumn;
+        this->_threadSegments.push_back(0);
+        if (this->_kernel == PlanKernel::REGISTER_BLOCKED)
+        {
+            // The register block kernels store their sums, so that an
+            // epilogue or streaming stores take a pass of their own.
+            this->_segmentKernel =
+                isIdentity(options.transform.epilogue) &&
+                        !this->_streamingStores
+                    ? registerBlocked
+                    : registerBlockedWithEpilogue;
+
+            const auto blocks = (packs + REGISTER_BLOCK_MAX_PACKS - 1) /
+                                REGISTER_BLOCK_MAX_PACKS;
+            for (size_t thread{0}; thread < threads; ++thread)
+            {
+                for (auto block = blocks * thread / threads;
+                     block < blocks * (thread + 1) / threads; ++block)
+                {
+                    const auto firstPack = block * REGISTER_BLOCK_MAX_PACKS;
+                    this->_segments.push_back(
+                        {firstPack,
+                         min(firstPack + REGISTER_BLOCK_MAX_PACKS, packs)});
+                }
+                this->_threadSegments.push_back(this->_segments.size());
+            }
+        }
+        else
+        {
+            this->_segmentKernel = this->_prefetchDistance > 0
+                                       ? prefetchedColumnPasses
+                                       : columnPasses;
+
+            for (size_t thread{0}; thread < threads; ++thread)
+            {
+                const auto firstPack = packs * thread / threads;
+                const auto lastPack = packs * (thread + 1) / threads;
+                if (firstPack < lastPack)
+                {
+                    this->_segments.push_back({firstPack, lastPack});
+                }
+                this->_threadSegments.push_back(this->_segments.size());
+            }
+        }
+    }
+
+    size_t TransformPlan::rows() const noexcept
+    {
+        return this->_rows;
+    }
+
+    size_t TransformPlan::columns() const noexcept
+    {
+        return this->_columns;
+    }
+
+    size_t TransformPlan::threads() const noexcept
+    {
+        return this->_threads;
+    }
+
+    PlanKernel TransformPlan::kernel() const noexcept
+    {
+        return this->_kernel;
+    }
+
+    void TransformPlan::columnPasses(const TransformPlan & plan,
+                                     const Segment & segment,
+                                     const AVXPack * matrix,
+                                     const AVXPack * input,
+                                     AVXPack * result) noexcept
+    {
+        sweepColumns<false>(matrix, plan._packsPerColumn, plan._columns, input,
+                            segment.firstPack, segment.lastPack,
+                            plan._epilogueOp, plan._streamingStores, 0, result);
+    }
+
+    void TransformPlan::prefetchedColumnPasses(const TransformPlan & plan,
+                                               const Segment & segment,
+                                               const AVXPack * matrix,
+                                               const AVXPack * input,
+                                               AVXPack * result) noexcept
+    {
+        sweepColumns<true>(matrix, plan._packsPerColumn, plan._columns, input,
+                           segment.firstPack, segment.lastPack,
+                           plan._epilogueOp, plan._streamingStores,
+                           plan._prefetchDistance, result);
+    }
+
+    void TransformPlan::registerBlocked(const TransformPlan & plan,
+                                        const Segment & segment,
+                                        const AVXPack * matrix,
+                                        const AVXPack * input,
+                                        AVXPack * result) noexcept
+    {
+        const auto firstPack = segment.firstPack;
+        const auto packs = segment.lastPack - firstPack;
+        REGISTER_BLOCK_KERNELS[packs - 1](matrix + firstPack,
+                                          plan._packsPerColumn, input,
+                                          plan._columns, result + firstPack);
+    }
+
+    void TransformPlan::registerBlockedWithEpilogue(const TransformPlan & plan,
+                                                    const Segment & segment,
+                                                    const AVXPack * matrix,
+                                                    const AVXPack * input,
+                                                    AVXPack * result) noexcept
+    {
+        registerBlocked(plan, segment, matrix, input, result);
+
+        // The block is still in the L1 cache, so that the epilogue costs
+        // little as a pass of its own.
+        for (auto p = segment.firstPack; p < segment.lastPack; ++p)
+        {
+            storeResult(
+                result[p].data(),
+                plan._epilogueOp(_mm256_load_ps(result[p].data()), p),
+                plan._streamingStores);
+        }
+    }
+
+    void TransformPlan::execute(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                AVXVector & result) const noexcept
+    {
+        assert(matrix.rows() == this->_rows);
+        assert(matrix.columns() == this->_columns);
+        assert(inputVector.size() == this->_columns);
+        assert(result.size() == this->_rows);
+
+        const auto * matrixPacks = matrix.packs().data();
+        const auto * inputPacks = inputVector.packs().data();
+        auto * resultPacks = result.packs().data();
+        for (const auto & segment : this->_segments)
+        {
+            this->_segmentKernel(*this, segment, matrixPacks, inputPacks,
+                                 resultPacks);
+        }
+
+        if (this->_streamingStores)
+        {
+            _mm_sfence();
+        }
+        this->finish(result);
+    }
+
+    void TransformPlan::execute(const SOAMatrix & matrix,
+                                const AVXVector & inputVector,
+                                AVXVector & result,
+                                const size_t thread) const noexcept
+    {
+        assert(matrix.rows() == this->_rows);
+        assert(matrix.columns() == this->_columns);
+        assert(inputVector.size() == this->_columns);
+        assert(result.size() == this->_rows);
+        assert(thread < this->_threads);
+
+        const auto * matrixPacks = matrix.packs().data();
+        const auto * inputPacks = inputVector.packs().data();
+        auto * resultPacks = result.packs().data();
+        for (auto s = this->_threadSegments[thread];
+             s < this->_threadSegments[thread + 1]; ++s)
+        {
+            this->_segmentKernel(*this, this->_segments[s], matrixPacks,
+                                 inputPacks, resultPacks);
+        }
+
+        // Each thread orders its own streaming stores.
+        if (this->_streamingStores)
+        {
+            _mm_sfence();
+        }
+    }
+
+    void TransformPlan::finish(AVXVector & result) const noexcept
+    {
+        // The padding rows of the matrix or the epilogue may have changed
+        // the padding of the result.
+        restorePadding(result);
+    }
+}
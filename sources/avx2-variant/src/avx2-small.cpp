@@ -0,0 +1,34 @@
+#include "avx2-small.h"
+
+#include "transform-operation.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    static_assert(REGISTER_BLOCK_MAX_PACKS * NUM_FLOATS_PER_AVX_REGISTER ==
+                  SMALL_KERNEL_MAX_ROWS);
+
+    bool isSmallShape(const SOAMatrix & matrix) noexcept
+    {
+        return matrix.rows() <= SMALL_KERNEL_MAX_ROWS;
+    }
+
+    void transformSmall(const SOAMatrix & matrix, const AVXVector & inputVector,
+                        AVXVector & result) noexcept
+    {
+        assert(isSmallShape(matrix));
+        assert(inputVector.size() == matrix.columns());
+        assert(result.size() == matrix.rows());
+
+        transformRegisterBlocked(matrix.packs().data(), matrix.rows(),
+                                 matrix.columns(), inputVector.packs().data(),
+                                 result.packs().data());
+
+        // The padding rows of the matrix may have flipped the sign of the
+        // padding in the result.
+        restorePadding(result);
+    }
+}
@@ -0,0 +1,92 @@
+#include "avx2-sparse.h"
+
+#include "transform-operation.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // Bit i of the mask is set if lane i of the pack is not zero. NaNs
+        // count as non-zero, so that they propagate like in transform. The
+        // padding compares equal to zero and never sets a bit.
+        inline unsigned nonZeroMask(const AVXPack & pack) noexcept
+        {
+            const auto packed = _mm256_load_ps(pack.data());
+            return static_cast<unsigned>(_mm256_movemask_ps(
+                _mm256_cmp_ps(packed, _mm256_setzero_ps(), _CMP_NEQ_UQ)));
+        }
+
+        // Calls the visitor with the index and value of each non-zero
+        // element of the vector in ascending order of the indices.
+        template <typename Visitor>
+        inline void forEachNonZero(const AVXVector & vector,
+                                   Visitor && visitor) noexcept
+        {
+            size_t first{0};
+            for (auto && pack : vector.packs())
+            {
+                auto mask = nonZeroMask(pack);
+                while (mask != 0)
+                {
+                    const auto lane = _tzcnt_u32(mask);
+                    visitor(first + lane, pack[lane]);
+
+                    // Clears the lowest set bit.
+                    mask &= mask - 1;
+                }
+                first += NUM_FLOATS_PER_AVX_REGISTER;
+            }
+        }
+    }
+
+    AVXVector transformSparse(const SOAMatrix & matrix,
+                              const vector<SparseElement> & inputElements)
+        noexcept
+    {
+        AVXVector result{matrix.rows(), 0.0F};
+
+        const TransformOperation transformOp{
+            matrix.rows(), matrix.packs().cbegin(), result};
+        for (auto && element : inputElements)
+        {
+            assert(element.index < matrix.columns());
+            transformOp(element.index, _mm256_set1_ps(element.value));
+        }
+
+        // The padding rows of the matrix may have flipped the sign of the
+        // padding in the result.
+        restorePadding(result);
+        return result;
+    }
+
+    AVXVector transformSparse(const SOAMatrix & matrix,
+                              const AVXVector & inputVector) noexcept
+    {
+        assert(inputVector.size() == matrix.columns());
+
+        AVXVector result{matrix.rows(), 0.0F};
+
+        const TransformOperation transformOp{
+            matrix.rows(), matrix.packs().cbegin(), result};
+        forEachNonZero(inputVector,
+                       [&](const size_t column, const float value) {
+                           transformOp(column, _mm256_set1_ps(value));
+                       });
+
+        restorePadding(result);
+        return result;
+    }
+
+    vector<SparseElement> nonZeroElements(const AVXVector & vector) noexcept
+    {
+        std::vector<SparseElement> elements;
+        forEachNonZero(vector, [&](const size_t index, const float value) {
+            elements.push_back(SparseElement{index, value});
+        });
+        return elements;
+    }
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <avx2-transform-options.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+// Building blocks of the single-threaded transformation shared by the
+// translation units of the avx2-variant.
+namespace matrixmultiplication::avx2
+{
+    template <int i> inline auto broadcast(const __m256 & value) noexcept
+    {
+        return _mm256_permute_ps(value, _MM_SHUFFLE(i, i, i, i));
+    }
+
+    inline auto unpackLow(const __m256 & packed) noexcept
+    {
+        return _mm256_permute2f128_ps(packed, packed, 0);
+    }
+
+    inline auto unpackHigh(const __m256 & packed) noexcept
+    {
+        return _mm256_permute2f128_ps(packed, packed, 0b00010001);
+    }
+
+    inline auto multiplyAdd(const __m256 & partialColumn,
+                            const __m256 & inputBroadcast,
+                            const __m256 & partialResult) noexcept
+    {
+        // There is no need to enforce an FMA op here. An intelligent compiler
+        // will optimize it to an FMA op if it is available for the target ARCH.
+        return _mm256_add_ps(_mm256_mul_ps(partialColumn, inputBroadcast),
+                             partialResult);
+    }
+
+    // Accumulates the columns of a block of PACKS row packs in registers and
+    // stores the block of the result once. The columns of the block are
+    // columnStride packs apart. Accumulates in the same order as
+    // TransformOperation, so that both give the same results.
+    template <std::size_t PACKS>
+    void registerBlockKernel(const AVXPack * column,
+                             const std::size_t columnStride,
+                             const AVXPack * input, const std::size_t columns,
+                             AVXPack * result) noexcept
+    {
+        __m256 sums[PACKS];
+        for (std::size_t p{0}; p < PACKS; ++p)
+        {
+            sums[p] = _mm256_setzero_ps();
+        }
+
+        for (std::size_t c{0}; c < columns; ++c)
+        {
+            const auto inputBroadcast = _mm256_broadcast_ss(
+                &input[c / NUM_FLOATS_PER_AVX_REGISTER]
+                      [c % NUM_FLOATS_PER_AVX_REGISTER]);
+            for (std::size_t p{0}; p < PACKS; ++p)
+            {
+                sums[p] = multiplyAdd(_mm256_load_ps(column[p].data()),
+                                      inputBroadcast, sums[p]);
+            }
+            column += columnStride;
+        }
+
+        for (std::size_t p{0}; p < PACKS; ++p)
+        {
+            _mm256_store_ps(result[p].data(), sums[p]);
+        }
+    }
+
+    using RegisterBlockKernel = void (*)(const AVXPack *, std::size_t,
+                                         const AVXPack *, std::size_t,
+                                         AVXPack *) noexcept;
+
+    // The kernels by their count of row packs minus one. Eight packs leave
+    // half of the AVX registers for the loads and the broadcast.
+    inline constexpr RegisterBlockKernel REGISTER_BLOCK_KERNELS[]{
+        registerBlockKernel<1>, registerBlockKernel<2>, registerBlockKernel<3>,
+        registerBlockKernel<4>, registerBlockKernel<5>, registerBlockKernel<6>,
+        registerBlockKernel<7>, registerBlockKernel<8>,
+    };
+
+    constexpr std::size_t REGISTER_BLOCK_MAX_PACKS{
+        sizeof(REGISTER_BLOCK_KERNELS) / sizeof(REGISTER_BLOCK_KERNELS[0])};
+
+    // Transforms by a matrix of any row count given by its first pack, in
+    // blocks of up to REGISTER_BLOCK_MAX_PACKS row packs. The matrix is read
+    // once, and each block of the result is stored once.
+    inline void transformRegisterBlocked(const AVXPack * matrix,
+                                         const std::size_t rows,
+                                         const std::size_t columns,
+                                         const AVXPack * input,
+                                         AVXPack * result) noexcept
+    {
+        const auto packsPerColumn = padSize(rows);
+        for (std::size_t block{0}; block < packsPerColumn;
+             block += REGISTER_BLOCK_MAX_PACKS)
+        {
+            const auto packs =
+                std::min(REGISTER_BLOCK_MAX_PACKS, packsPerColumn - block);
+            REGISTER_BLOCK_KERNELS[packs - 1](matrix + block, packsPerColumn,
+                                              input, columns, result + block);
+        }
+    }
+
+    // Multiplies a broadcast vector of one column element in the input
+    // vector element-wise with the column vector of a matrix (that is
+    // represented by a row in the SOAMatrix). That helps to split the code of
+    // the transform function.
+    class TransformOperation
+    {
+        std::size_t packsPerColumn;
+        std::vector<AVXPack>::const_iterator _dataStart;
+        AVXVector & _resultVector;
+        std::size_t _prefetchDistance;
+
+      public:
+        TransformOperation(const std::size_t rows,
+                           const std::vector<AVXPack>::const_iterator dataStart,
+                           AVXVector & resultVector,
+                           const std::size_t prefetchDistance = 0) noexcept
+            : packsPerColumn(padSize(rows)), _dataStart(dataStart),
+              _resultVector(resultVector), _prefetchDistance(prefetchDistance)
+        {
+            assert(rows > 0);
+        }
+
+        void operator()(const std::size_t column,
+                        const __m256 & inputBroadcast) const noexcept
+        {
+            // Thanks to the SOA layout, each row in SOAMatrix contains AVX
+            // fitting partial vectors of the elements of the corresponding
+            // column "c" in the AOS matrix, so that we can directly load
+            // the data into fitting AVX registers, multiply the elements
+            // and add the result back into our intermediate result vector.
+            auto rowIt = this->_dataStart +
+                         static_cast<int64_t>(column * this->packsPerColumn);
+            for (auto && resultPack : _resultVector.packs())
+            {
+                if (this->_prefetchDistance > 0)
+                {
+                    prefetchAhead(*rowIt, this->_prefetchDistance);
+                }
+
+                const auto partialColumn = _mm256_load_ps(rowIt->data());
+                const auto partialResult = _mm256_load_ps(resultPack.data());
+                const auto intermediate =
+                    multiplyAdd(partialColumn, inputBroadcast, partialResult);
+                _mm256_store_ps(resultPack.data(), intermediate);
+
+                ++rowIt;
+            }
+        }
+
+        // Performs the last column pass, which applies the epilogue to each
+        // result pack before storing it. The consumer is called with the
+        // index of each pack right after it was finalized.
+        template <typename PackConsumer>
+        void operator()(const std::size_t column, const __m256 & inputBroadcast,
+                        const EpilogueOperation & epilogueOp,
+                        const bool streamingStores,
+                        PackConsumer && consumer) const noexcept
+        {
+            auto rowIt = this->_dataStart +
+                         static_cast<int64_t>(column * this->packsPerColumn);
+            std::size_t p{0};
+            for (auto && resultPack : _resultVector.packs())
+            {
+                if (this->_prefetchDistance > 0)
+                {
+                    prefetchAhead(*rowIt, this->_prefetchDistance);
+                }
+
+                const auto partialColumn = _mm256_load_ps(rowIt->data());
+                const auto partialResult = _mm256_load_ps(resultPack.data());
+                const auto intermediate =
+                    multiplyAdd(partialColumn, inputBroadcast, partialResult);
+                storeResult(resultPack.data(), epilogueOp(intermediate, p),
+                            streamingStores);
+
+                consumer(p);
+                ++rowIt;
+                ++p;
+            }
+
+            // Orders the streamed packs before the padding is restored with
+            // regular stores, which would otherwise flush the partially
+            // written line of the last pack from the write-combining buffer.
+            if (streamingStores)
+            {
+                _mm_sfence();
+            }
+
+            restorePadding(_resultVector);
+        }
+
+        void operator()(const std::size_t column, const __m256 & inputBroadcast,
+                        const EpilogueOperation & epilogueOp,
+                        const bool streamingStores) const noexcept
+        {
+            (*this)(column, inputBroadcast, epilogueOp, streamingStores,
+                    [](std::size_t) {});
+        }
+    };
+}
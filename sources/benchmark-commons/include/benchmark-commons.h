@@ -0,0 +1,131 @@
+#pragma once
+
+#include <avx2-model.h>
+#include <scalar-variant.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace matrixmultiplication::benchmark
+{
+    // Command line arguments of the form key=value.
+    class BenchmarkArguments
+    {
+        std::map<std::string, std::string> _values;
+
+      public:
+        // Parses the arguments starting at index first of argv.
+        BenchmarkArguments(const int argc, const char * const * argv,
+                           const int first) noexcept;
+
+        std::size_t get(const std::string & key,
+                        const std::size_t defaultValue) const noexcept;
+
+        std::string get(const std::string & key,
+                        const char * defaultValue) const noexcept;
+    };
+
+    struct Shape
+    {
+        std::size_t rows;
+        std::size_t columns;
+    };
+
+    // Parses a comma separated list of shapes like 64x64,1024x256 and skips
+    // malformed entries.
+    std::vector<Shape> parseShapes(const std::string & list) noexcept;
+
+    // Statistics over the durations of repeated runs of a benchmarked
+    // function.
+    struct Timing
+    {
+        std::size_t repetitions;
+        double minimumNanoseconds;
+        double medianNanoseconds;
+        double p99Nanoseconds;
+    };
+
+    // Computes the statistics over the measured durations.
+    Timing summarize(std::vector<double> nanoseconds) noexcept;
+
+    // Runs the function once for warming up the caches and then measures
+    // the given count of runs.
+    template <typename Function>
+    Timing measure(const std::size_t repetitions, Function && function) noexcept
+    {
+        function();
+
+        std::vector<double> nanoseconds;
+        nanoseconds.reserve(repetitions);
+        for (std::size_t i{0}; i < repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto end = std::chrono::steady_clock::now();
+
+            nanoseconds.push_back(
+                std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        return summarize(std::move(nanoseconds));
+    }
+
+    // One result of a benchmark, which is written as a flat JSON object.
+    class BenchmarkRecord
+    {
+        // The values are kept JSON encoded.
+        std::vector<std::pair<std::string, std::string>> _fields;
+
+      public:
+        BenchmarkRecord & add(const std::string & key,
+                              const std::string & value) noexcept;
+        BenchmarkRecord & add(const std::string & key,
+                              const double value) noexcept;
+        BenchmarkRecord & add(const std::string & key,
+                              const std::size_t value) noexcept;
+
+        // Adds the statistics of the timing and the throughput derived from
+        // the given count of floating point operations and bytes moved per
+        // run.
+        BenchmarkRecord & add(const Timing & timing, const double flops,
+                              const double bytes) noexcept;
+
+        // The fields in the order of their addition with JSON encoded
+        // values.
+        const std::vector<std::pair<std::string, std::string>> & fields()
+            const noexcept;
+
+        void write(std::ostream & out) const noexcept;
+    };
+
+    // Writes the records as JSON array.
+    void writeRecords(std::ostream & out,
+                      const std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Writes the records as CSV with a header of all keys in the order of
+    // their first occurrence. Missing fields stay empty and strings keep
+    // their quotes.
+    void writeRecordsAsCsv(
+        std::ostream & out,
+        const std::vector<BenchmarkRecord> & records) noexcept;
+
+    // Random but reproducible values in [-1, 1] for benchmark inputs.
+    avx2::SOAMatrix randomMatrix(const std::size_t rows,
+                                 const std::size_t columns) noexcept;
+    avx2::AVXVector randomVector(const std::size_t size) noexcept;
+
+    // Copies of the inputs for the scalar variant.
+    scalar::ScalarMatrix toScalarMatrix(
+        const avx2::SOAMatrix & matrix) noexcept;
+    scalar::ScalarVector toScalarVector(
+        const avx2::AVXVector & vector) noexcept;
+
+    // Bytes a transformation has to read at least from the matrix.
+    double matrixBytes(const avx2::SOAMatrix & matrix) noexcept;
+}
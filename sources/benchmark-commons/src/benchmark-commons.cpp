@@ -0,0 +1,275 @@
+#include "benchmark-commons.h"
+
+#include <cstring>
+#include <random>
+#include <sstream>
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+using namespace matrixmultiplication::scalar;
+
+namespace matrixmultiplication::benchmark
+{
+    BenchmarkArguments::BenchmarkArguments(const int argc,
+                                           const char * const * argv,
+                                           const int first) noexcept
+    {
+        for (auto i = first; i < argc; ++i)
+        {
+            const auto separator = strchr(argv[i], '=');
+            if (separator != nullptr)
+            {
+                this->_values.emplace(string(argv[i], separator),
+                                      string(separator + 1));
+            }
+        }
+    }
+
+    size_t BenchmarkArguments::get(const string & key,
+                                   const size_t defaultValue) const noexcept
+    {
+        const auto it = this->_values.find(key);
+        if (it == this->_values.end())
+        {
+            return defaultValue;
+        }
+        return static_cast<size_t>(strtoull(it->second.c_str(), nullptr, 10));
+    }
+
+    string BenchmarkArguments::get(const string & key,
+                                   const char * defaultValue) const noexcept
+    {
+        const auto it = this->_values.find(key);
+        return it == this->_values.end() ? string(defaultValue) : it->second;
+    }
+
+    Timing summarize(vector<double> nanoseconds) noexcept
+    {
+        if (nanoseconds.empty())
+        {
+            return Timing{0, 0.0, 0.0, 0.0};
+        }
+
+        sort(nanoseconds.begin(), nanoseconds.end());
+
+        const auto count = nanoseconds.size();
+        const auto p99Index = min(count - 1, count * 99 / 100);
+        return Timing{count, nanoseconds.front(), nanoseconds[count / 2],
+                      nanoseconds[p99Index]};
+    }
+
+    string toJson(const string & value) noexcept
+    {
+        string json{"\""};
+        for (auto c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                json += '\\';
+            }
+            json += c;
+        }
+        return json + "\"";
+    }
+
+    BenchmarkRecord & BenchmarkRecord::add(const string & key,
+                                           const string & value) noexcept
+    {
+        this->_fields.emplace_back(key, toJson(value));
+        return *this;
+    }
+
+    BenchmarkRecord & BenchmarkRecord::add(const string & key,
+                                           const double value) noexcept
+    {
+        ostringstream json;
+        json << value;
+        this->_fields.emplace_back(key, json.str());
+        return *this;
+    }
+
+    BenchmarkRecord & BenchmarkRecord::add(const string & key,
+                                           const size_t value) noexcept
+    {
+        this->_fields.emplace_back(key, to_string(value));
+        return *this;
+    }
+
+    BenchmarkRecord & BenchmarkRecord::add(const Timing & timing,
+                                           const double flops,
+                                           const double bytes) noexcept
+    {
+        this->add("repetitions", timing.repetitions)
+            .add("minimumNanoseconds", timing.minimumNanoseconds)
+            .add("medianNanoseconds", timing.medianNanoseconds)
+            .add("p99Nanoseconds", timing.p99Nanoseconds);
+
+        // Flops per nanosecond equal GFLOP/s and bytes per nanosecond GB/s.
+        if (timing.medianNanoseconds > 0.0)
+        {
+            this->add("gflops", flops / timing.medianNanoseconds)
+                .add("gigabytesPerSecond", bytes / timing.medianNanoseconds);
+        }
+        return *this;
+    }
+
+    const vector<pair<string, string>> & BenchmarkRecord::fields()
+        const noexcept
+    {
+        return this->_fields;
+    }
+
+    void BenchmarkRecord::write(ostream & out) const noexcept
+    {
+        out << "{";
+        for (size_t i{0}; i < this->_fields.size(); ++i)
+        {
+            out << (i > 0 ? ", " : "") << toJson(this->_fields[i].first) << ": "
+                << this->_fields[i].second;
+        }
+        out << "}";
+    }
+
+    void writeRecords(ostream & out,
+                      const vector<BenchmarkRecord> & records) noexcept
+    {
+        out << "[" << endl;
+        for (size_t i{0}; i < records.size(); ++i)
+        {
+            out << "  ";
+            records[i].write(out);
+            out << (i + 1 < records.size() ? "," : "") << endl;
+        }
+        out << "]" << endl;
+    }
+
+    void writeRecordsAsCsv(ostream & out,
+                           const vector<BenchmarkRecord> & records) noexcept
+    {
+        vector<string> keys;
+        for (auto && record : records)
+        {
+            for (auto && field : record.fields())
+            {
+                if (find(keys.begin(), keys.end(), field.first) == keys.end())
+                {
+                    keys.push_back(field.first);
+                }
+            }
+        }
+
+        for (size_t k{0}; k < keys.size(); ++k)
+        {
+            out << (k > 0 ? "," : "") << keys[k];
+        }
+        out << endl;
+
+        for (auto && record : records)
+        {
+            for (size_t k{0}; k < keys.size(); ++k)
+            {
+                out << (k > 0 ? "," : "");
+                for (auto && field : record.fields())
+                {
+                    if (field.first == keys[k])
+                    {
+                        out << field.second;
+                        break;
+                    }
+                }
+            }
+            out << endl;
+        }
+    }
+
+    // A fixed seed keeps the inputs equal across runs and hosts.
+    mt19937 & randomEngine() noexcept
+    {
+        static mt19937 engine{42};
+        return engine;
+    }
+
+    SOAMatrix randomMatrix(const size_t rows, const size_t columns) noexcept
+    {
+        uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+
+        SOAMatrix matrix{rows, columns};
+        for (size_t c{0}; c < columns; ++c)
+        {
+            for (size_t r{0}; r < rows; ++r)
+            {
+                matrix.at(r, c) = distribution(randomEngine());
+            }
+        }
+        return matrix;
+    }
+
+    AVXVector randomVector(const size_t size) noexcept
+    {
+        uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+
+        AVXVector vector(size);
+        for (size_t i{0}; i < size; ++i)
+        {
+            vector.at(i) = distribution(randomEngine());
+        }
+        return vector;
+    }
+
+    ScalarMatrix toScalarMatrix(const SOAMatrix & matrix) noexcept
+    {
+        ScalarMatrix scalarMatrix{matrix.rows(), matrix.columns()};
+        for (size_t r{0}; r < matrix.rows(); ++r)
+        {
+            for (size_t c{0}; c < matrix.columns(); ++c)
+            {
+                scalarMatrix.at(r, c) = matrix.at(r, c);
+            }
+        }
+        return scalarMatrix;
+    }
+
+    ScalarVector toScalarVector(const AVXVector & vector) noexcept
+    {
+        ScalarVector scalarVector(vector.size());
+        for (size_t i{0}; i < vector.size(); ++i)
+        {
+            scalarVector[i] = vector.at(i);
+        }
+        return scalarVector;
+    }
+
+    vector<Shape> parseShapes(const string & list) noexcept
+    {
+        vector<Shape> shapes;
+        size_t start{0};
+        while (start < list.size())
+        {
+            auto end = list.find(',', start);
+            if (end == string::npos)
+            {
+                end = list.size();
+            }
+
+            const auto shape = list.substr(start, end - start);
+            const auto separator = shape.find('x');
+            if (separator != string::npos)
+            {
+                const auto rows = strtoull(shape.c_str(), nullptr, 10);
+                const auto columns =
+                    strtoull(shape.c_str() + separator + 1, nullptr, 10);
+                if (rows > 0 && columns > 0)
+                {
+                    shapes.push_back(Shape{rows, columns});
+                }
+            }
+            start = end + 1;
+        }
+        return shapes;
+    }
+
+    double matrixBytes(const SOAMatrix & matrix) noexcept
+    {
+        return static_cast<double>(matrix.packs().size() * sizeof(AVXPack));
+    }
+}
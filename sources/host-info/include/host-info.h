@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace matrixmultiplication::host
+{
+    // Sizes in bytes of the data caches of the executing host. A size of a
+    // cache level the host does not report is replaced by a conservative
+    // default, so that callers can always use these values as thresholds.
+    struct CacheSizes
+    {
+        std::size_t l1d;
+        std::size_t l2;
+        std::size_t l3;
+    };
+
+    // Queries the cache sizes once and returns the same result afterwards.
+    const CacheSizes & cacheSizes() noexcept;
+
+    // The brand string of the executing CPU as reported by CPUID, e.g. to
+    // key measurements that only hold for one CPU model. Queried once like
+    // the cache sizes, and "unknown" if the CPU does not report it.
+    const std::string & cpuModel() noexcept;
+}
@@ -0,0 +1,150 @@
+#include "host-info.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__GNUC__)
+#include <cpuid.h>
+#include <unistd.h>
+#else
+#include <Windows.h>
+#include <intrin.h>
+
+#include <vector>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::host
+{
+    // Typical sizes of a desktop CPU around the time AVX2 was introduced.
+    constexpr CacheSizes DEFAULT_CACHE_SIZES{32 * 1024, 256 * 1024,
+                                             8 * 1024 * 1024};
+
+    size_t orDefault(const long long reported, const size_t fallback) noexcept
+    {
+        return reported > 0 ? static_cast<size_t>(reported) : fallback;
+    }
+
+#if defined(__GNUC__)
+
+    CacheSizes queryCacheSizes() noexcept
+    {
+        return CacheSizes{
+            orDefault(sysconf(_SC_LEVEL1_DCACHE_SIZE), DEFAULT_CACHE_SIZES.l1d),
+            orDefault(sysconf(_SC_LEVEL2_CACHE_SIZE), DEFAULT_CACHE_SIZES.l2),
+            orDefault(sysconf(_SC_LEVEL3_CACHE_SIZE), DEFAULT_CACHE_SIZES.l3),
+        };
+    }
+
+#else
+
+    CacheSizes queryCacheSizes() noexcept
+    {
+        DWORD bufferSize{0};
+        GetLogicalProcessorInformation(nullptr, &bufferSize);
+
+        vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+            bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+        if (infos.empty() ||
+            !GetLogicalProcessorInformation(infos.data(), &bufferSize))
+        {
+            return DEFAULT_CACHE_SIZES;
+        }
+
+        long long l1d{0};
+        long long l2{0};
+        long long l3{0};
+        for (auto && info : infos)
+        {
+            if (info.Relationship != RelationCache ||
+                info.Cache.Type == CacheInstruction)
+            {
+                continue;
+            }
+
+            switch (info.Cache.Level)
+            {
+            case 1:
+                l1d = info.Cache.Size;
+                break;
+            case 2:
+                l2 = info.Cache.Size;
+                break;
+            case 3:
+                l3 = info.Cache.Size;
+                break;
+            default:
+                break;
+            }
+        }
+
+        return CacheSizes{
+            orDefault(l1d, DEFAULT_CACHE_SIZES.l1d),
+            orDefault(l2, DEFAULT_CACHE_SIZES.l2),
+            orDefault(l3, DEFAULT_CACHE_SIZES.l3),
+        };
+    }
+
+#endif
+
+    const CacheSizes & cacheSizes() noexcept
+    {
+        static const CacheSizes sizes = queryCacheSizes();
+        return sizes;
+    }
+
+    // Runs CPUID for the leaf into EAX, EBX, ECX and EDX, or returns false
+    // if the CPU does not support the leaf.
+    bool cpuid(const unsigned leaf, array<unsigned, 4> & registers) noexcept
+    {
+#if defined(__GNUC__)
+        return __get_cpuid(leaf, &registers[0], &registers[1], &registers[2],
+                           &registers[3]) != 0;
+#else
+        array<int, 4> signedRegisters{};
+        __cpuid(signedRegisters.data(), static_cast<int>(leaf & 0x80000000U));
+        if (static_cast<unsigned>(signedRegisters[0]) < leaf)
+        {
+            return false;
+        }
+        __cpuid(signedRegisters.data(), static_cast<int>(leaf));
+        memcpy(registers.data(), signedRegisters.data(), sizeof(registers));
+        return true;
+#endif
+    }
+
+    string queryCpuModel() noexcept
+    {
+        // The extended leaves 0x80000002 to 0x80000004 return 16 characters
+        // of the brand string each.
+        string model;
+        for (unsigned leaf{0x80000002U}; leaf <= 0x80000004U; ++leaf)
+        {
+            array<unsigned, 4> registers{};
+            if (!cpuid(leaf, registers))
+            {
+                return "unknown";
+            }
+
+            char characters[sizeof(registers)];
+            memcpy(characters, registers.data(), sizeof(registers));
+            model.append(characters, sizeof(characters));
+        }
+
+        // The string is padded with spaces and terminated with zeros.
+        model.resize(strlen(model.c_str()));
+        const auto first = model.find_first_not_of(' ');
+        if (first == string::npos)
+        {
+            return "unknown";
+        }
+        return model.substr(first, model.find_last_not_of(' ') - first + 1);
+    }
+
+    const string & cpuModel() noexcept
+    {
+        static const string model = queryCpuModel();
+        return model;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+namespace matrixmultiplication::profiling
+{
+    // Hardware counter values of a profiled section. The counters are only
+    // collected when the project is configured with PERF_COUNTERS=1 on Linux
+    // and the host permits perf_event_open. Otherwise available is false and
+    // all counters are zero.
+    struct PerfStats
+    {
+        bool available{false};
+        std::uint64_t cycles{0};
+        std::uint64_t instructions{0};
+        std::uint64_t llcMisses{0};
+        std::uint64_t dtlbMisses{0};
+
+        // The nanoseconds the counters were enabled and actually counting.
+        // The kernel multiplexes the counters with the ones of other users
+        // of the PMU, and then a difference of readings extrapolates the
+        // counts to the whole time enabled.
+        std::uint64_t timeEnabled{0};
+        std::uint64_t timeRunning{0};
+
+        // Compulsory memory traffic of the section, i.e. the bytes of the
+        // matrix and the vectors, which is not counted but derived from the
+        // shapes.
+        double bytesMoved{0.0};
+    };
+
+    // Difference of two readings of the counters. The counts are scaled by
+    // the time enabled over the time running in between, and are not
+    // available if the counters never ran in between.
+    PerfStats operator-(const PerfStats & after,
+                        const PerfStats & before) noexcept;
+
+    // Whether the counts are extrapolated, because the counters were
+    // multiplexed for part of the time.
+    inline bool isMultiplexed(const PerfStats & stats) noexcept
+    {
+        return stats.timeRunning < stats.timeEnabled;
+    }
+
+    // Reads the counters of the calling thread. They are opened on the first
+    // reading in a thread as one group, which the PMU always schedules as a
+    // whole, so that ratios of the counts refer to the same instructions.
+    // They stay enabled until the thread exits.
+    PerfStats readThreadCounters() noexcept;
+
+    // Reads the counters of all threads of an OpenMP team as sum.
+    PerfStats readTeamCounters() noexcept;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "perf-counters.h"
+
+#include <avx2-model.h>
+#include <scalar-variant.h>
+
+namespace matrixmultiplication::profiling
+{
+    // The transformation variants wrapped by readings of the hardware
+    // counters, which are written into the stats.
+
+    scalar::ScalarVector transform(const scalar::ScalarMatrix & matrix,
+                                   const scalar::ScalarVector & inputVector,
+                                   PerfStats & stats) noexcept;
+
+    avx2::AVXVector transform(const avx2::SOAMatrix & matrix,
+                              const avx2::AVXVector & inputVector,
+                              PerfStats & stats) noexcept;
+
+    // Sums up the counters of all threads of the OpenMP team.
+    avx2::AVXVector transformMultiThreaded(const avx2::SOAMatrix & matrix,
+                                           const avx2::AVXVector & inputVector,
+                                           PerfStats & stats) noexcept;
+}
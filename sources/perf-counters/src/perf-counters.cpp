@@ -0,0 +1,204 @@
+#include "perf-counters.h"
+
+#if defined(PERF_COUNTERS_ENABLED) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::profiling
+{
+    PerfStats operator-(const PerfStats & after,
+                        const PerfStats & before) noexcept
+    {
+        const auto timeEnabled = after.timeEnabled - before.timeEnabled;
+        const auto timeRunning = after.timeRunning - before.timeRunning;
+        const auto scale =
+            timeRunning > 0 ? static_cast<double>(timeEnabled) /
+                                  static_cast<double>(timeRunning)
+                            : 0.0;
+        const auto difference = [scale](const uint64_t afterCount,
+                                        const uint64_t beforeCount) {
+            return static_cast<uint64_t>(
+                static_cast<double>(afterCount - beforeCount) * scale + 0.5);
+        };
+
+        return PerfStats{
+            after.available && before.available && timeRunning > 0,
+            difference(after.cycles, before.cycles),
+            difference(after.instructions, before.instructions),
+            difference(after.llcMisses, before.llcMisses),
+            difference(after.dtlbMisses, before.dtlbMisses),
+            timeEnabled,
+            timeRunning,
+            after.bytesMoved - before.bytesMoved,
+        };
+    }
+
+#if defined(PERF_COUNTERS_ENABLED) && defined(__linux__)
+
+    namespace
+    {
+        constexpr uint64_t DTLB_READ_MISSES{
+            PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+
+        constexpr size_t COUNTERS{4};
+
+        // Opens a counter of the calling thread on any CPU. The group leader
+        // is opened with a group descriptor of -1 and reads all members of
+        // its group at once, along with the times enabled and running.
+        int openCounter(const uint32_t type, const uint64_t config,
+                        const int groupLeader) noexcept
+        {
+            perf_event_attr attributes;
+            memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = type;
+            attributes.config = config;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_GROUP |
+                                     PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes,
+                                            0, -1, groupLeader, 0));
+        }
+
+        // The counters of one thread as one group led by the cycles, which
+        // are kept enabled from their opening on, so that a reading costs
+        // only one read call.
+        class ThreadCounters
+        {
+            // The cycles, instructions, LLC and dTLB misses. Counters the
+            // host does not support are -1 and read as zero.
+            array<int, COUNTERS> _descriptors;
+
+          public:
+            ThreadCounters() noexcept : _descriptors{-1, -1, -1, -1}
+            {
+                const auto leader =
+                    openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,
+                                -1);
+                if (leader < 0)
+                {
+                    return;
+                }
+
+                this->_descriptors = {
+                    leader,
+                    openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+                                leader),
+                    openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,
+                                leader),
+                    openCounter(PERF_TYPE_HW_CACHE, DTLB_READ_MISSES, leader),
+                };
+            }
+
+            ~ThreadCounters() noexcept
+            {
+                for (auto descriptor : this->_descriptors)
+                {
+                    if (descriptor >= 0)
+                    {
+                        close(descriptor);
+                    }
+                }
+            }
+
+            ThreadCounters(const ThreadCounters &) = delete;
+            ThreadCounters & operator=(const ThreadCounters &) = delete;
+
+            PerfStats read() const noexcept
+            {
+                const auto leader = this->_descriptors[0];
+                if (leader < 0)
+                {
+                    return PerfStats{};
+                }
+
+                // The count of members, the times enabled and running, and
+                // the value of each member in the order they were opened.
+                array<uint64_t, 3 + COUNTERS> group{};
+                const auto bytes = ::read(leader, group.data(),
+                                          sizeof(group[0]) * group.size());
+                if (bytes < static_cast<ssize_t>(3 * sizeof(group[0])))
+                {
+                    return PerfStats{};
+                }
+
+                array<uint64_t, COUNTERS> values{};
+                size_t member{0};
+                for (size_t i{0}; i < COUNTERS; ++i)
+                {
+                    if (this->_descriptors[i] >= 0 && member < group[0])
+                    {
+                        values[i] = group[3 + member];
+                        ++member;
+                    }
+                }
+
+                return PerfStats{
+                    true,
+                    values[0],
+                    values[1],
+                    values[2],
+                    values[3],
+                    group[1],
+                    group[2],
+                    0.0,
+                };
+            }
+        };
+    }
+
+    PerfStats readThreadCounters() noexcept
+    {
+        thread_local const ThreadCounters counters{};
+        return counters.read();
+    }
+
+    PerfStats readTeamCounters() noexcept
+    {
+        PerfStats sum{true};
+
+#pragma omp parallel
+        {
+            const auto stats = readThreadCounters();
+
+#pragma omp critical
+            {
+                sum.available = sum.available && stats.available;
+                sum.cycles += stats.cycles;
+                sum.instructions += stats.instructions;
+                sum.llcMisses += stats.llcMisses;
+                sum.dtlbMisses += stats.dtlbMisses;
+                sum.timeEnabled += stats.timeEnabled;
+                sum.timeRunning += stats.timeRunning;
+            }
+        }
+
+        return sum;
+    }
+
+#else
+
+    PerfStats readThreadCounters() noexcept
+    {
+        return PerfStats{};
+    }
+
+    PerfStats readTeamCounters() noexcept
+    {
+        return PerfStats{};
+    }
+
+#endif
+}
@@ -0,0 +1,64 @@
+#include "profiled-transforms.h"
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+using namespace std;
+
+namespace matrixmultiplication::profiling
+{
+    namespace
+    {
+        double bytesOf(const avx2::AVXVector & vector) noexcept
+        {
+            return static_cast<double>(vector.packs().size() *
+                                       sizeof(avx2::AVXPack));
+        }
+
+        double bytesOf(const avx2::SOAMatrix & matrix) noexcept
+        {
+            return static_cast<double>(matrix.packs().size() *
+                                       sizeof(avx2::AVXPack));
+        }
+    }
+
+    scalar::ScalarVector transform(const scalar::ScalarMatrix & matrix,
+                                   const scalar::ScalarVector & inputVector,
+                                   PerfStats & stats) noexcept
+    {
+        const auto before = readThreadCounters();
+        auto result = scalar::transform(matrix, inputVector);
+        stats = readThreadCounters() - before;
+
+        const auto elements =
+            matrix.rows() * matrix.columns() + matrix.columns() + matrix.rows();
+        stats.bytesMoved = static_cast<double>(elements * sizeof(float));
+        return result;
+    }
+
+    avx2::AVXVector transform(const avx2::SOAMatrix & matrix,
+                              const avx2::AVXVector & inputVector,
+                              PerfStats & stats) noexcept
+    {
+        const auto before = readThreadCounters();
+        auto result = avx2::transform(matrix, inputVector);
+        stats = readThreadCounters() - before;
+
+        stats.bytesMoved =
+            bytesOf(matrix) + bytesOf(inputVector) + bytesOf(result);
+        return result;
+    }
+
+    avx2::AVXVector transformMultiThreaded(const avx2::SOAMatrix & matrix,
+                                           const avx2::AVXVector & inputVector,
+                                           PerfStats & stats) noexcept
+    {
+        const auto before = readTeamCounters();
+        auto result = avx2::transformMultiThreaded(matrix, inputVector);
+        stats = readTeamCounters() - before;
+
+        stats.bytesMoved =
+            bytesOf(matrix) + bytesOf(inputVector) + bytesOf(result);
+        return result;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <benchmark-commons.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace matrixmultiplication::roofline
+{
+    // Measured bandwidth of one level of the memory hierarchy.
+    struct MemoryLevel
+    {
+        const char * name;
+
+        // A kernel whose working set fits into the capacity is served by
+        // this level.
+        std::size_t capacity;
+
+        // Working set of the bandwidth measurement, which is the one of each
+        // thread for the private caches and the one of all threads for the
+        // shared levels.
+        std::size_t bytes;
+
+        double gigabytesPerSecond;
+    };
+
+    // The roofs of the executing host for a count of threads.
+    struct MachinePeaks
+    {
+        int threads;
+        double gflops;
+
+        // Ordered from the L1 cache to the DRAM.
+        std::vector<MemoryLevel> levels;
+
+        // The level that serves a working set of the given size.
+        const MemoryLevel & levelFor(const std::size_t bytes) const noexcept;
+    };
+
+    // Measures the peak FMA throughput and a STREAM-like read bandwidth for
+    // the L1, L2 and L3 caches and the DRAM, using the given count of
+    // threads.
+    MachinePeaks measureMachinePeaks(
+        const int threads,
+        const benchmark::BenchmarkArguments & arguments) noexcept;
+}
+
+int main(int argc, char * argv[]) noexcept;
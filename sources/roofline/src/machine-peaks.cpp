@@ -0,0 +1,224 @@
+#include "roofline.h"
+
+#include <host-info.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace matrixmultiplication::avx2;
+using namespace matrixmultiplication::benchmark;
+
+namespace matrixmultiplication::roofline
+{
+    namespace
+    {
+        // Enough independent accumulators to cover the latency of the FMA
+        // units of two ports.
+        constexpr size_t FMA_CHAINS{10};
+
+        // Likewise for the adds consuming two loads per cycle.
+        constexpr size_t READ_CHAINS{8};
+
+        // Volatile sink of the sums of the measured loops, so that the
+        // compiler keeps them. Only written outside the parallel regions.
+        volatile float sink{0.0F};
+
+        float sumOf(const __m256 & value) noexcept
+        {
+            alignas(32) array<float, NUM_FLOATS_PER_AVX_REGISTER> lanes{};
+            _mm256_store_ps(lanes.data(), value);
+
+            auto sum = 0.0F;
+            for (auto lane : lanes)
+            {
+                sum += lane;
+            }
+            return sum;
+        }
+
+        float runFmaChains(const size_t iterations) noexcept
+        {
+            __m256 accumulators[FMA_CHAINS];
+            for (auto && accumulator : accumulators)
+            {
+                accumulator = _mm256_set1_ps(1.0F);
+            }
+
+            // Keeps the accumulators bounded around 1.
+            const auto multiplier = _mm256_set1_ps(0.999999F);
+            const auto addend = _mm256_set1_ps(0.000001F);
+
+            for (size_t i{0}; i < iterations; ++i)
+            {
+                for (auto && accumulator : accumulators)
+                {
+                    accumulator =
+                        _mm256_fmadd_ps(accumulator, multiplier, addend);
+                }
+            }
+
+            auto sum = _mm256_setzero_ps();
+            for (auto && accumulator : accumulators)
+            {
+                sum = _mm256_add_ps(sum, accumulator);
+            }
+            return sumOf(sum);
+        }
+
+        float runReadSweeps(const vector<AVXPack> & data,
+                           const size_t sweeps) noexcept
+        {
+            __m256 sums[READ_CHAINS]{};
+            for (size_t sweep{0}; sweep < sweeps; ++sweep)
+            {
+                for (size_t i{0}; i + READ_CHAINS <= data.size();
+                     i += READ_CHAINS)
+                {
+                    for (size_t j{0}; j < READ_CHAINS; ++j)
+                    {
+                        sums[j] = _mm256_add_ps(
+                            sums[j], _mm256_load_ps(data[i + j].data()));
+                    }
+                }
+            }
+
+            auto sum = _mm256_setzero_ps();
+            for (auto && partialSum : sums)
+            {
+                sum = _mm256_add_ps(sum, partialSum);
+            }
+            return sumOf(sum);
+        }
+
+        // Runs the work on all threads at once and returns the best of
+        // several wall clock times in nanoseconds. Each thread prepares the
+        // data passed to its work once, outside of the timed runs. The work
+        // returns a sum, which ends up in the sink.
+        template <typename Prepare, typename Work>
+        double bestTime(const int threads, Prepare && prepare,
+                        Work && work) noexcept
+        {
+            auto best = numeric_limits<double>::max();
+            auto checksum = 0.0F;
+            chrono::steady_clock::time_point start;
+
+#pragma omp parallel num_threads(threads) reduction(+ : checksum)
+            {
+                auto data = prepare();
+                for (auto repetition = 0; repetition < 5; ++repetition)
+                {
+#pragma omp barrier
+#pragma omp single
+                    start = chrono::steady_clock::now();
+
+                    checksum += work(data);
+
+#pragma omp barrier
+#pragma omp single
+                    best = min(best, chrono::duration<double, nano>(
+                                         chrono::steady_clock::now() - start)
+                                         .count());
+                }
+            }
+
+            sink = sink + checksum;
+            return best;
+        }
+
+        double measureGflops(const int threads) noexcept
+        {
+            const size_t iterations{10000000};
+            const auto nanoseconds = bestTime(
+                threads, [iterations]() { return iterations; }, runFmaChains);
+
+            const auto flops = 2.0 * NUM_FLOATS_PER_AVX_REGISTER * FMA_CHAINS *
+                               static_cast<double>(iterations) * threads;
+            return flops / nanoseconds;
+        }
+
+        // The working set of a private level is the one of each thread, the
+        // one of a shared level is split among the threads.
+        enum class Sharing
+        {
+            PRIVATE,
+            SHARED
+        };
+
+        MemoryLevel measureLevel(const char * name, const size_t capacity,
+                                 const size_t bytes, const Sharing sharing,
+                                 const int threads) noexcept
+        {
+            // Each thread sweeps its own working set, which it allocates and
+            // thereby touches once before the measurement.
+            const auto threadBytes =
+                sharing == Sharing::SHARED
+                    ? bytes / static_cast<size_t>(threads)
+                    : bytes;
+            const auto packs = max(READ_CHAINS, threadBytes / sizeof(AVXPack));
+            const auto sweeps =
+                max(size_t{1}, (size_t{1} << 30) / threadBytes);
+
+            const auto nanoseconds = bestTime(
+                threads,
+                [packs]() { return vector<AVXPack>(packs); },
+                [sweeps](const vector<AVXPack> & data) {
+                    return runReadSweeps(data, sweeps);
+                });
+
+            const auto movedBytes =
+                static_cast<double>(packs * sizeof(AVXPack) * sweeps) *
+                threads;
+            return MemoryLevel{name, capacity, bytes, movedBytes / nanoseconds};
+        }
+    }
+
+    const MemoryLevel & MachinePeaks::levelFor(
+        const size_t bytes) const noexcept
+    {
+        for (auto && level : this->levels)
+        {
+            if (bytes <= level.capacity)
+            {
+                return level;
+            }
+        }
+        return this->levels.back();
+    }
+
+    MachinePeaks measureMachinePeaks(
+        const int threads, const BenchmarkArguments & arguments) noexcept
+    {
+        // Half of each cache leaves room for other data. The L3 working set
+        // stays just above the L2, because a large L3 is often shared by
+        // partitions that a single core reaches only slowly. The DRAM
+        // working set exceeds the last level cache by far.
+        const auto & caches = host::cacheSizes();
+        const auto l3Bytes = min(4 * caches.l2, caches.l3 / 2);
+        const auto dramBytes = arguments.get(
+            "dramBytes", min(4 * caches.l3, size_t{1} << 30));
+
+        return MachinePeaks{
+            threads,
+            measureGflops(threads),
+            {
+                measureLevel("L1", caches.l1d, caches.l1d / 2,
+                             Sharing::PRIVATE, threads),
+                measureLevel("L2", caches.l2, caches.l2 / 2, Sharing::PRIVATE,
+                             threads),
+                measureLevel("L3", caches.l3, l3Bytes, Sharing::SHARED,
+                             threads),
+                measureLevel("DRAM", numeric_limits<size_t>::max(),
+                             dramBytes, Sharing::SHARED, threads),
+            },
+        };
+    }
+}
@@ -0,0 +1,164 @@
+#include "roofline.h"
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+#include <scalar-variant.h>
+
+#include <iostream>
+#include <omp.h>
+
+using namespace std;
+using namespace matrixmultiplication;
+using namespace matrixmultiplication::avx2;
+using namespace matrixmultiplication::benchmark;
+using namespace matrixmultiplication::roofline;
+
+namespace
+{
+    void addPeaks(const MachinePeaks & peaks,
+                  vector<BenchmarkRecord> & records) noexcept
+    {
+        records.push_back(BenchmarkRecord{}
+                              .add("kind", "peak")
+                              .add("threads", size_t(peaks.threads))
+                              .add("gflops", peaks.gflops));
+
+        // Kernels left of the ridge intensity are bound by the level.
+        for (auto && level : peaks.levels)
+        {
+            records.push_back(
+                BenchmarkRecord{}
+                    .add("kind", "bandwidth")
+                    .add("threads", size_t(peaks.threads))
+                    .add("level", level.name)
+                    .add("capacity", level.capacity)
+                    .add("workingSetBytes", level.bytes)
+                    .add("gigabytesPerSecond", level.gigabytesPerSecond)
+                    .add("ridgeIntensity",
+                         peaks.gflops / level.gigabytesPerSecond));
+        }
+    }
+
+    // Places a measured kernel under the roofs of the level serving its
+    // working set.
+    void addKernel(const char * variant, const Shape & shape,
+                   const MachinePeaks & peaks, const Timing & timing,
+                   const double bytes,
+                   vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto flops =
+            2.0 * static_cast<double>(shape.rows * shape.columns);
+        const auto intensity = flops / bytes;
+        const auto & level = peaks.levelFor(static_cast<size_t>(bytes));
+
+        const auto memoryRoof = intensity * level.gigabytesPerSecond;
+        const auto attainable = min(peaks.gflops, memoryRoof);
+        const auto attained =
+            timing.medianNanoseconds > 0.0 ? flops / timing.medianNanoseconds
+                                           : 0.0;
+
+        records.push_back(
+            BenchmarkRecord{}
+                .add("kind", "kernel")
+                .add("variant", variant)
+                .add("rows", shape.rows)
+                .add("columns", shape.columns)
+                .add("threads", size_t(peaks.threads))
+                .add(timing, flops, bytes)
+                .add("arithmeticIntensity", intensity)
+                .add("workingSetBytes", static_cast<size_t>(bytes))
+                .add("level", level.name)
+                .add("bound", memoryRoof < peaks.gflops ? "memory" : "compute")
+                .add("attainableGflops", attainable)
+                .add("fractionOfRoof", attained / attainable));
+    }
+
+    void runKernels(const Shape & shape, const size_t repetitions,
+                    const MachinePeaks & singleThreadPeaks,
+                    const MachinePeaks & teamPeaks,
+                    vector<BenchmarkRecord> & records) noexcept
+    {
+        const auto matrix = randomMatrix(shape.rows, shape.columns);
+        const auto inputVector = randomVector(shape.columns);
+        const auto scalarMatrix = toScalarMatrix(matrix);
+        const auto scalarInputVector = toScalarVector(inputVector);
+
+        // Compulsory traffic of one transformation: the matrix, the input
+        // and the result vector.
+        const auto vectorPacks =
+            inputVector.packs().size() + padSize(shape.rows);
+        const auto bytes = matrixBytes(matrix) +
+                           static_cast<double>(vectorPacks * sizeof(AVXPack));
+
+        {
+            scalar::ScalarVector result;
+            const auto timing = measure(repetitions, [&]() {
+                result = scalar::transform(scalarMatrix, scalarInputVector);
+            });
+            addKernel("scalar", shape, singleThreadPeaks, timing, bytes,
+                      records);
+        }
+
+        {
+            AVXVector result(shape.rows);
+            const auto timing = measure(repetitions, [&]() {
+                result = avx2::transform(matrix, inputVector);
+            });
+            addKernel("avx2", shape, singleThreadPeaks, timing, bytes,
+                      records);
+        }
+
+        {
+            AVXVector result(shape.rows);
+            const auto timing = measure(repetitions, [&]() {
+                result = avx2::transformMultiThreaded(matrix, inputVector);
+            });
+            addKernel("avx2-mt", shape, teamPeaks, timing, bytes, records);
+        }
+    }
+}
+
+int main(int argc, char * argv[]) noexcept
+{
+    const BenchmarkArguments arguments{argc, argv, 1};
+    const auto shapes = parseShapes(
+        arguments.get("shapes", "64x64,256x256,1024x1024,4096x4096"));
+    const auto repetitions = arguments.get("repetitions", size_t{20});
+    const auto format = arguments.get("format", "json");
+
+    if (shapes.empty() || (format != "json" && format != "csv"))
+    {
+        cerr << "usage: roofline [shapes=64x64,256x256,1024x1024,4096x4096]"
+                " [repetitions=20] [format=json|csv] [dramBytes=...]"
+             << endl;
+        return 1;
+    }
+
+    // The single threaded kernels are placed under the roofs of one core,
+    // the multi threaded kernel under those of all cores.
+    const auto singleThreadPeaks = measureMachinePeaks(1, arguments);
+    const auto teamPeaks =
+        measureMachinePeaks(omp_get_max_threads(), arguments);
+
+    vector<BenchmarkRecord> records;
+    addPeaks(singleThreadPeaks, records);
+    if (teamPeaks.threads > 1)
+    {
+        addPeaks(teamPeaks, records);
+    }
+
+    for (auto && shape : shapes)
+    {
+        runKernels(shape, repetitions, singleThreadPeaks, teamPeaks, records);
+    }
+
+    if (format == "csv")
+    {
+        writeRecordsAsCsv(cout, records);
+    }
+    else
+    {
+        writeRecords(cout, records);
+    }
+    return 0;
+}
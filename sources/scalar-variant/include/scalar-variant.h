@@ -30,4 +30,8 @@ namespace matrixmultiplication::scalar
 
     ScalarVector transform(const ScalarMatrix & matrix,
                            const ScalarVector & inputVector) noexcept;
+
+    // Reference MxK * KxN -> MxN matrix-matrix multiplication.
+    ScalarMatrix multiply(const ScalarMatrix & a,
+                          const ScalarMatrix & b) noexcept;
 }
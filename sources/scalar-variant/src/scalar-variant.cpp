@@ -60,4 +60,29 @@ namespace matrixmultiplication::scalar
 
         return result;
     }
+
+    ScalarMatrix multiply(const ScalarMatrix & a,
+                          const ScalarMatrix & b) noexcept
+    {
+        assert(a.columns() == b.rows());
+
+        ScalarMatrix result{a.rows(), b.columns()};
+
+        for (size_t r{0}; r < a.rows(); ++r)
+        {
+            for (size_t c{0}; c < b.columns(); ++c)
+            {
+                auto sum = 0.0F;
+
+                for (size_t k{0}; k < a.columns(); ++k)
+                {
+                    sum += a.at(r, k) * b.at(k, c);
+                }
+
+                result.at(r, c) = sum;
+            }
+        }
+
+        return result;
+    }
 }
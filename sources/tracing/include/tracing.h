@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+// Per-call tracing of the phases of the transformations. Each thread records
+// the time stamp counter at the begin and end of a phase into a ring buffer
+// of its own, which needs no locks and no allocation once the thread
+// recorded its first phase. The phase scopes compile out entirely unless
+// the project is configured with TRACING=1, and record only while tracing
+// is enabled at runtime.
+namespace matrixmultiplication::tracing
+{
+#if defined(TRACING_ENABLED)
+    constexpr bool COMPILED_IN{true};
+#else
+    constexpr bool COMPILED_IN{false};
+#endif
+
+    // The events kept per thread. Older events are overwritten.
+    constexpr std::size_t RING_CAPACITY{8192};
+
+    enum class Phase : std::uint8_t
+    {
+        // A whole transformation on the calling thread, so that the gaps
+        // before the phases of the other threads show their wake-up.
+        CALL,
+        ALLOCATION,
+        COMPUTE,
+
+        // Adding partial results, including waiting for the lock.
+        MERGE,
+        EPILOGUE
+    };
+
+    const char * phaseName(const Phase phase) noexcept;
+
+    struct Event
+    {
+        std::uint64_t beginTicks;
+        std::uint64_t endTicks;
+        Phase phase;
+
+        // The index of the recording thread in the order the threads
+        // recorded their first event.
+        std::uint32_t thread;
+    };
+
+    inline std::uint64_t ticks() noexcept
+    {
+        return __rdtsc();
+    }
+
+    void setEnabled(const bool enabled) noexcept;
+    bool isEnabled() noexcept;
+
+    // Appends the event to the ring buffer of the calling thread.
+    void record(const Phase phase, const std::uint64_t beginTicks,
+                const std::uint64_t endTicks) noexcept;
+
+    // Returns the events of all threads recorded since the last clear,
+    // ordered by their begin. Events a thread records meanwhile may be
+    // missing or, if its ring buffer wraps around, garbled, so that it is
+    // best called while no transformation runs.
+    std::vector<Event> collect() noexcept;
+
+    // Discards the events recorded so far.
+    void clear() noexcept;
+
+    // Writes the events in the Chrome trace event format, which chrome://
+    // tracing and Perfetto display as one timeline per thread. The time
+    // stamps are converted to microseconds since the first event.
+    void writeChromeTrace(const std::vector<Event> & events,
+                          std::ostream & stream) noexcept;
+
+    // Writes the collected events to the file, and returns whether that
+    // succeeded.
+    bool writeChromeTrace(const std::string & path) noexcept;
+
+    // Records the lifetime of the scope as phase of the calling thread.
+    template <bool ENABLED> class BasicPhaseScope
+    {
+        Phase _phase;
+        bool _active;
+        std::uint64_t _beginTicks;
+
+      public:
+        explicit BasicPhaseScope(const Phase phase) noexcept
+            : _phase{phase}, _active{isEnabled()},
+              _beginTicks{this->_active ? ticks() : 0}
+        {
+        }
+
+        ~BasicPhaseScope() noexcept
+        {
+            if (this->_active)
+            {
+                record(this->_phase, this->_beginTicks, ticks());
+            }
+        }
+
+        BasicPhaseScope(const BasicPhaseScope &) = delete;
+        BasicPhaseScope & operator=(const BasicPhaseScope &) = delete;
+    };
+
+    // Without tracing compiled in, the scopes are empty and vanish.
+    template <> class BasicPhaseScope<false>
+    {
+      public:
+        explicit BasicPhaseScope(const Phase) noexcept
+        {
+        }
+
+        BasicPhaseScope(const BasicPhaseScope &) = delete;
+        BasicPhaseScope & operator=(const BasicPhaseScope &) = delete;
+    };
+
+    using PhaseScope = BasicPhaseScope<COMPILED_IN>;
+}
@@ -0,0 +1,222 @@
+#include "tracing.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace matrixmultiplication::tracing
+{
+    namespace
+    {
+        static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0,
+                      "the ring index is masked");
+
+        // Written by its thread only. The head counts all events ever
+        // recorded, so that readers know which slots hold the newest ones.
+        struct ThreadBuffer
+        {
+            array<Event, RING_CAPACITY> events{};
+            atomic<uint64_t> head{0};
+            uint32_t thread{0};
+        };
+
+        // The buffers of all threads that ever recorded. They are kept
+        // after their thread exits, so that its events can still be dumped.
+        struct Registry
+        {
+            mutex lock;
+            vector<unique_ptr<ThreadBuffer>> buffers;
+        };
+
+        Registry & registry() noexcept
+        {
+            static Registry instance;
+            return instance;
+        }
+
+        ThreadBuffer * registerThread() noexcept
+        {
+            auto & instance = registry();
+            const lock_guard<mutex> guard{instance.lock};
+            auto buffer = make_unique<ThreadBuffer>();
+            buffer->thread = static_cast<uint32_t>(instance.buffers.size());
+            instance.buffers.push_back(move(buffer));
+            return instance.buffers.back().get();
+        }
+
+        ThreadBuffer & threadBuffer() noexcept
+        {
+            thread_local ThreadBuffer * buffer = registerThread();
+            return *buffer;
+        }
+
+        atomic<bool> enabled{false};
+
+        // Events that begin before are discarded by clear.
+        atomic<uint64_t> clearedTicks{0};
+
+        // A pair of readings of the time stamp counter and the steady
+        // clock, which relates ticks to time.
+        struct ClockReading
+        {
+            uint64_t ticks;
+            chrono::steady_clock::time_point time;
+
+            static ClockReading now() noexcept
+            {
+                return {tracing::ticks(), chrono::steady_clock::now()};
+            }
+        };
+
+        const ClockReading & firstReading() noexcept
+        {
+            static const ClockReading reading = ClockReading::now();
+            return reading;
+        }
+
+        // The ticks per microsecond measured since the first reading,
+        // which lasts at least the minimum calibration time.
+        double ticksPerMicrosecond() noexcept
+        {
+            constexpr chrono::milliseconds MINIMUM_CALIBRATION{20};
+
+            const auto & first = firstReading();
+            const auto elapsed = chrono::steady_clock::now() - first.time;
+            if (elapsed < MINIMUM_CALIBRATION)
+            {
+                this_thread::sleep_for(MINIMUM_CALIBRATION - elapsed);
+            }
+
+            const auto last = ClockReading::now();
+            const auto microseconds =
+                chrono::duration<double, micro>(last.time - first.time)
+                    .count();
+            return static_cast<double>(last.ticks - first.ticks) /
+                   microseconds;
+        }
+    }
+
+    const char * phaseName(const Phase phase) noexcept
+    {
+        switch (phase)
+        {
+        case Phase::CALL:
+            return "call";
+        case Phase::ALLOCATION:
+            return "allocation";
+        case Phase::COMPUTE:
+            return "compute";
+        case Phase::MERGE:
+            return "merge";
+        case Phase::EPILOGUE:
+            return "epilogue";
+        }
+        return "unknown";
+    }
+
+    void setEnabled(const bool enable) noexcept
+    {
+        // Starts the calibration of the time stamp counter.
+        firstReading();
+        enabled.store(enable, memory_order_relaxed);
+    }
+
+    bool isEnabled() noexcept
+    {
+        return enabled.load(memory_order_relaxed);
+    }
+
+    void record(const Phase phase, const uint64_t beginTicks,
+                const uint64_t endTicks) noexcept
+    {
+        auto & buffer = threadBuffer();
+        const auto head = buffer.head.load(memory_order_relaxed);
+        buffer.events[head & (RING_CAPACITY - 1)] =
+            Event{beginTicks, endTicks, phase, buffer.thread};
+
+        // Publishes the event to the readers of the head.
+        buffer.head.store(head + 1, memory_order_release);
+    }
+
+    vector<Event> collect() noexcept
+    {
+        const auto cleared = clearedTicks.load(memory_order_relaxed);
+
+        vector<Event> events;
+        {
+            auto & instance = registry();
+            const lock_guard<mutex> guard{instance.lock};
+            for (const auto & buffer : instance.buffers)
+            {
+                const auto head = buffer->head.load(memory_order_acquire);
+                const auto first =
+                    head > RING_CAPACITY ? head - RING_CAPACITY : 0;
+                for (auto i = first; i < head; ++i)
+                {
+                    const auto & event =
+                        buffer->events[i & (RING_CAPACITY - 1)];
+                    if (event.beginTicks >= cleared)
+                    {
+                        events.push_back(event);
+                    }
+                }
+            }
+        }
+
+        sort(events.begin(), events.end(),
+             [](const Event & left, const Event & right) {
+                 return left.beginTicks < right.beginTicks;
+             });
+        return events;
+    }
+
+    void clear() noexcept
+    {
+        clearedTicks.store(ticks(), memory_order_relaxed);
+    }
+
+    void writeChromeTrace(const vector<Event> & events,
+                          ostream & stream) noexcept
+    {
+        const auto scale = 1.0 / ticksPerMicrosecond();
+        const auto origin = events.empty() ? 0 : events.front().beginTicks;
+
+        const auto flags = stream.flags();
+        const auto precision = stream.precision();
+        stream << fixed << setprecision(3);
+
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (size_t i{0}; i < events.size(); ++i)
+        {
+            const auto & event = events[i];
+            stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\""
+                   << phaseName(event.phase)
+                   << "\",\"cat\":\"transform\",\"ph\":\"X\",\"pid\":1"
+                   << ",\"tid\":" << event.thread << ",\"ts\":"
+                   << static_cast<double>(event.beginTicks - origin) * scale
+                   << ",\"dur\":"
+                   << static_cast<double>(event.endTicks - event.beginTicks) *
+                          scale
+                   << "}";
+        }
+        stream << "\n]}\n";
+
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+
+    bool writeChromeTrace(const string & path) noexcept
+    {
+        ofstream file{path};
+        writeChromeTrace(collect(), file);
+        return static_cast<bool>(file);
+    }
+}
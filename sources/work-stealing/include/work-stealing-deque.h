@@ -0,0 +1,169 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace matrixmultiplication::scheduling
+{
+    // Chase-Lev work-stealing deque after "Correct and Efficient
+    // Work-Stealing for Weak Memory Models" (Lê et al., 2013). Its owner
+    // pushes and pops at the bottom, while any other thread steals from the
+    // top. The ring buffer grows on demand, and outgrown buffers are kept
+    // until destruction, because a thief may still read from them.
+    template <typename T> class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "items are copied through atomics");
+
+        class Buffer
+        {
+            std::size_t _mask;
+            std::unique_ptr<std::atomic<T>[]> _items;
+
+          public:
+            explicit Buffer(const std::size_t capacity) noexcept
+                : _mask(capacity - 1),
+                  _items(std::make_unique<std::atomic<T>[]>(capacity))
+            {
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return static_cast<std::int64_t>(this->_mask + 1);
+            }
+
+            T get(const std::int64_t index) const noexcept
+            {
+                return this->_items[static_cast<std::size_t>(index) &
+                                    this->_mask]
+                    .load(std::memory_order_relaxed);
+            }
+
+            void put(const std::int64_t index, const T & item) noexcept
+            {
+                this->_items[static_cast<std::size_t>(index) & this->_mask]
+                    .store(item, std::memory_order_relaxed);
+            }
+        };
+
+        // Top and bottom live on separate cache lines, because the thieves
+        // contend on the top only.
+        alignas(64) std::atomic<std::int64_t> _top{0};
+        alignas(64) std::atomic<std::int64_t> _bottom{0};
+        std::atomic<Buffer *> _buffer;
+        std::vector<std::unique_ptr<Buffer>> _buffers;
+
+      public:
+        // The capacity is rounded up to a power of two.
+        explicit WorkStealingDeque(const std::size_t capacity = 64) noexcept
+        {
+            std::size_t powerOfTwo{1};
+            while (powerOfTwo < capacity)
+            {
+                powerOfTwo *= 2;
+            }
+
+            this->_buffers.push_back(std::make_unique<Buffer>(powerOfTwo));
+            this->_buffer.store(this->_buffers.back().get(),
+                                std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+        WorkStealingDeque & operator=(const WorkStealingDeque &) = delete;
+
+        // Owner only.
+        void push(const T & item) noexcept
+        {
+            const auto bottom = this->_bottom.load(std::memory_order_relaxed);
+            const auto top = this->_top.load(std::memory_order_acquire);
+            auto buffer = this->_buffer.load(std::memory_order_relaxed);
+
+            if (bottom - top > buffer->capacity() - 1)
+            {
+                auto grown = std::make_unique<Buffer>(
+                    static_cast<std::size_t>(2 * buffer->capacity()));
+                for (auto i = top; i < bottom; ++i)
+                {
+                    grown->put(i, buffer->get(i));
+                }
+
+                buffer = grown.get();
+                this->_buffers.push_back(std::move(grown));
+                this->_buffer.store(buffer, std::memory_order_release);
+            }
+
+            buffer->put(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only. Takes the most recently pushed item.
+        std::optional<T> pop() noexcept
+        {
+            const auto bottom =
+                this->_bottom.load(std::memory_order_relaxed) - 1;
+            const auto buffer = this->_buffer.load(std::memory_order_relaxed);
+            this->_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = this->_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            const auto item = buffer->get(bottom);
+            if (top == bottom)
+            {
+                // The last item, which a thief may take concurrently.
+                const auto won = this->_top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+                if (!won)
+                {
+                    return std::nullopt;
+                }
+            }
+            return item;
+        }
+
+        // Any thread. Takes the least recently pushed item, and fails
+        // spuriously when losing a race for it.
+        std::optional<T> steal() noexcept
+        {
+            auto top = this->_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto bottom = this->_bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return std::nullopt;
+            }
+
+            const auto item =
+                this->_buffer.load(std::memory_order_acquire)->get(top);
+            if (!this->_top.compare_exchange_strong(top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed))
+            {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        // Only a snapshot while other threads access the deque.
+        std::size_t size() const noexcept
+        {
+            const auto bottom = this->_bottom.load(std::memory_order_relaxed);
+            const auto top = this->_top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace matrixmultiplication::scheduling
+{
+    // Counts of a scheduled run, which tell how well the tasks were
+    // balanced ahead of time.
+    struct SchedulingStats
+    {
+        std::size_t tasks;
+        std::size_t steals;
+        int workers;
+    };
+
+    // Runs the task for each index in [0, taskCount) on the OpenMP threads.
+    // Each worker starts with a contiguous block of the indices in its own
+    // deque, so that the dense case keeps the locality of a static split,
+    // and steals from random other workers once its deque runs empty.
+    SchedulingStats runWorkStealing(
+        const std::size_t taskCount,
+        const std::function<void(std::size_t)> & task) noexcept;
+}
@@ -0,0 +1,117 @@
+#include "work-stealing.h"
+#include "work-stealing-deque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <omp.h>
+
+#if defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace matrixmultiplication::scheduling
+{
+    namespace
+    {
+        // Picks the victims of a worker, which need not be uniform but must
+        // differ between the workers.
+        class XorShift
+        {
+            uint32_t _state;
+
+          public:
+            explicit XorShift(const int seed) noexcept
+                : _state(0x9E3779B9U * static_cast<uint32_t>(seed + 1))
+            {
+            }
+
+            uint32_t operator()() noexcept
+            {
+                this->_state ^= this->_state << 13;
+                this->_state ^= this->_state >> 17;
+                this->_state ^= this->_state << 5;
+                return this->_state;
+            }
+        };
+    }
+
+    SchedulingStats runWorkStealing(
+        const size_t taskCount, const function<void(size_t)> & task) noexcept
+    {
+        if (taskCount == 0)
+        {
+            return SchedulingStats{0, 0, 0};
+        }
+
+        const auto maxWorkers = static_cast<int>(
+            min(taskCount, static_cast<size_t>(omp_get_max_threads())));
+        vector<WorkStealingDeque<size_t>> deques(
+            static_cast<size_t>(maxWorkers));
+
+        atomic<size_t> remainingTasks{taskCount};
+        atomic<size_t> steals{0};
+        auto workers = int{1};
+
+#pragma omp parallel num_threads(maxWorkers)
+        {
+            const auto worker = omp_get_thread_num();
+            const auto workerCount = omp_get_num_threads();
+            auto & deque = deques[static_cast<size_t>(worker)];
+
+#pragma omp single
+            workers = workerCount;
+
+            // Pushed in reverse, so that the owner pops its block in
+            // ascending order and thieves take it from the far end.
+            const auto first = taskCount * static_cast<size_t>(worker) /
+                               static_cast<size_t>(workerCount);
+            const auto last = taskCount * static_cast<size_t>(worker + 1) /
+                              static_cast<size_t>(workerCount);
+            for (auto i = last; i > first; --i)
+            {
+                deque.push(i - 1);
+            }
+
+#pragma omp barrier
+
+            XorShift random{worker};
+            size_t workerSteals{0};
+            while (remainingTasks.load(memory_order_acquire) > 0)
+            {
+                auto index = deque.pop();
+                if (!index && workerCount > 1)
+                {
+                    const auto victim =
+                        static_cast<int>(random() %
+                                         static_cast<uint32_t>(workerCount));
+                    if (victim != worker)
+                    {
+                        index = deques[static_cast<size_t>(victim)].steal();
+                        workerSteals += index ? 1 : 0;
+                    }
+                }
+
+                if (index)
+                {
+                    task(*index);
+                    remainingTasks.fetch_sub(1, memory_order_acq_rel);
+                }
+                else
+                {
+                    _mm_pause();
+                }
+            }
+
+            steals.fetch_add(workerSteals, memory_order_relaxed);
+        }
+
+        return SchedulingStats{taskCount, steals.load(), workers};
+    }
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <avx2-async.h>
+#include <avx2-coalescer.h>
+
+#include <catch2/catch.hpp>
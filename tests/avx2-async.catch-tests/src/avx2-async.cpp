@@ -0,0 +1,107 @@
+#include "test_commons.h"
+
+#include <atomic>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("Asynchronous AVX2 transformation")
+    {
+        GIVEN("a 10x10 scaling matrix and an asynchronous transformer")
+        {
+            const auto scalingMatrix = []() {
+                SOAMatrix m{10, 10};
+                for (size_t i{0}; i < 10; ++i)
+                {
+                    m.at(i, i) = 2.0F;
+                }
+                return m;
+            }();
+
+            const auto input = [](const float offset) {
+                std::vector<float> v(10);
+                for (size_t i{0}; i < v.size(); ++i)
+                {
+                    v[i] = offset + static_cast<float>(i);
+                }
+                return v;
+            };
+
+            const auto expected = [](const float offset) {
+                AVXVector v(10);
+                for (size_t i{0}; i < v.size(); ++i)
+                {
+                    v.at(i) = 2.0F * (offset + static_cast<float>(i));
+                }
+                return v;
+            };
+
+            AsyncTransformer transformer{2};
+
+            WHEN("submitting an input for a future result")
+            {
+                auto result = transformer.submit(scalingMatrix, input(1.0F));
+
+                THEN("the future yields the transformed vector")
+                {
+                    REQUIRE_THAT(result.get().packs(),
+                                 Equals(expected(1.0F).packs()));
+                }
+            }
+
+            WHEN("submitting a queue of jobs with their outputs")
+            {
+                std::vector<AVXVector> outputs(16, AVXVector(10));
+                std::vector<std::future<void>> done;
+                for (size_t j{0}; j < outputs.size(); ++j)
+                {
+                    done.push_back(transformer.submit(
+                        TransformJob{&scalingMatrix,
+                                     input(static_cast<float>(j)),
+                                     &outputs[j]}));
+                }
+
+                THEN("each job writes its own output")
+                {
+                    for (size_t j{0}; j < outputs.size(); ++j)
+                    {
+                        done[j].wait();
+                        REQUIRE_THAT(
+                            outputs[j].packs(),
+                            Equals(expected(static_cast<float>(j)).packs()));
+                    }
+                }
+            }
+        }
+
+        GIVEN("jobs with completion callbacks")
+        {
+            const SOAMatrix onesMatrix{3, 4, 1.0F};
+            std::atomic<int> completions{0};
+            std::atomic<int> correctResults{0};
+
+            WHEN("destroying the transformer right after submitting them")
+            {
+                {
+                    AsyncTransformer transformer;
+                    for (auto j = 0; j < 8; ++j)
+                    {
+                        transformer.submit(
+                            onesMatrix, std::vector<float>(4, 1.0F),
+                            [&](AVXVector result) {
+                                ++completions;
+                                correctResults += result.at(2) == 4.0F;
+                            });
+                    }
+                }
+
+                THEN("all submitted jobs complete first")
+                {
+                    REQUIRE(completions == 8);
+                    REQUIRE(correctResults == 8);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include "test_commons.h"
+
+#include <avx2-variant.h>
+
+#include <thread>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("Coalescing concurrent AVX2 transformations")
+    {
+        GIVEN("a matrix and a coalescer with a generous window")
+        {
+            SOAMatrix matrix{19, 11};
+            for (size_t r{0}; r < matrix.rows(); ++r)
+            {
+                for (size_t c{0}; c < matrix.columns(); ++c)
+                {
+                    matrix.at(r, c) = static_cast<float>((r + c) % 4) - 1.0F;
+                }
+            }
+
+            CoalescingWindow window{};
+            window.maxDelay = std::chrono::milliseconds(20);
+            window.maxBatch = 4;
+            TransformCoalescer coalescer{matrix, window};
+
+            WHEN("several threads request transformations concurrently")
+            {
+                const size_t clients{8};
+                std::vector<AVXVector> inputVectors;
+                for (size_t t{0}; t < clients; ++t)
+                {
+                    inputVectors.emplace_back(11, static_cast<float>(t));
+                }
+
+                std::vector<AVXVector> results(clients, AVXVector(19));
+                std::vector<std::thread> threads;
+                for (size_t t{0}; t < clients; ++t)
+                {
+                    threads.emplace_back([&, t]() {
+                        results[t] = coalescer.transform(inputVectors[t]);
+                    });
+                }
+                for (auto && thread : threads)
+                {
+                    thread.join();
+                }
+
+                THEN("each caller receives the result of its own input")
+                {
+                    for (size_t t{0}; t < clients; ++t)
+                    {
+                        const auto expected = avx2::transform(
+                            matrix, inputVectors[t]);
+                        REQUIRE_THAT(results[t].packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+
+                THEN("the requests were transformed in fewer batches")
+                {
+                    const auto stats = coalescer.stats();
+                    REQUIRE(stats.requests == clients);
+                    REQUIRE(stats.batches < clients);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <avx2-autotune.h>
+#include <avx2-test-fixtures.h>
+#include <avx2-variant.h>
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <string>
+
+namespace matrixmultiplication::autotune
+{
+    using avx2::integralMatrix;
+    using avx2::integralVector;
+
+    // A tuning file in the temporary directory, which is removed before
+    // and after the test.
+    class TemporaryTuningFile
+    {
+        std::filesystem::path _path;
+
+      public:
+        explicit TemporaryTuningFile(const std::string & name)
+            : _path{std::filesystem::temp_directory_path() / name}
+        {
+            std::filesystem::remove(this->_path);
+        }
+
+        ~TemporaryTuningFile()
+        {
+            std::error_code error;
+            std::filesystem::remove(this->_path, error);
+        }
+
+        std::string path() const
+        {
+            return this->_path.string();
+        }
+    };
+}
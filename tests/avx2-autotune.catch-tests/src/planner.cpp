@@ -0,0 +1,164 @@
+#include "test_commons.h"
+
+#include <host-info.h>
+
+#include <fstream>
+#include <sstream>
+
+using Catch::Matchers::Contains;
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::autotune
+{
+    namespace
+    {
+        std::string readFile(const std::string & path)
+        {
+            std::ifstream file{path};
+            std::ostringstream content;
+            content << file.rdbuf();
+            return content.str();
+        }
+    }
+
+    SCENARIO("Planning tuned transformations")
+    {
+        GIVEN("a planner with an empty tuning file and a matrix")
+        {
+            const TemporaryTuningFile tuningFile{"avx2-autotune-planner.tsv"};
+            Planner planner{tuningFile.path(), 1};
+            const auto matrix = integralMatrix(45, 33);
+            const auto inputVector = integralVector(33);
+            const auto expected = avx2::transform(matrix, inputVector);
+
+            WHEN("planning the shape twice")
+            {
+                const auto plan = planner.plan(matrix);
+                const auto again = planner.plan(matrix);
+
+                THEN("the shape is tuned once and the plans transform")
+                {
+                    REQUIRE(planner.tuningRuns() == 1);
+                    REQUIRE(plan.choice().kernel == again.choice().kernel);
+
+                    avx2::AVXVector result(45);
+                    plan.transform(inputVector, result);
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+
+            WHEN("planning the shape for a batch as well")
+            {
+                planner.plan(matrix);
+                const auto plan = planner.plan(matrix, 4);
+
+                THEN("the batch is tuned as a shape of its own")
+                {
+                    REQUIRE(planner.tuningRuns() == 2);
+
+                    const std::vector<const avx2::AVXVector *> inputs(
+                        4, &inputVector);
+                    for (const auto & result : plan.transform(inputs))
+                    {
+                        REQUIRE_THAT(result.packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("a second planner reads the tuning file")
+            {
+                const auto choice = planner.choose(matrix);
+                Planner second{tuningFile.path(), 1};
+                const auto secondChoice = second.choose(matrix);
+
+                THEN("it reuses the choice without tuning")
+                {
+                    REQUIRE(second.tuningRuns() == 0);
+                    REQUIRE(secondChoice.kernel == choice.kernel);
+                    REQUIRE(secondChoice.threads == choice.threads);
+                    REQUIRE(secondChoice.rowPanelPacks ==
+                            choice.rowPanelPacks);
+                    REQUIRE(secondChoice.prefetchDistance ==
+                            choice.prefetchDistance);
+                    REQUIRE_THAT(readFile(tuningFile.path()),
+                                 Contains(host::cpuModel() + "\t45\t33\t1\t"));
+                }
+            }
+        }
+
+        GIVEN("a tuning file with entries of another CPU model")
+        {
+            const TemporaryTuningFile tuningFile{"avx2-autotune-foreign.tsv"};
+            const std::string foreignLine{
+                "Other CPU\t45\t33\t1\tpacked\t0\t4\t0\t0\t100"};
+            {
+                std::ofstream file{tuningFile.path()};
+                file << foreignLine << '\n';
+            }
+
+            WHEN("tuning a shape for the executing CPU model")
+            {
+                Planner planner{tuningFile.path(), 1};
+                planner.choose(integralMatrix(45, 33));
+
+                THEN("the shape is tuned and the other entries are kept")
+                {
+                    REQUIRE(planner.tuningRuns() == 1);
+                    REQUIRE_THAT(readFile(tuningFile.path()),
+                                 Contains(foreignLine));
+                }
+            }
+        }
+
+        GIVEN("a tuning file with a column panel width that splits a pack")
+        {
+            const TemporaryTuningFile tuningFile{"avx2-autotune-invalid.tsv"};
+            {
+                std::ofstream file{tuningFile.path()};
+                file << host::cpuModel()
+                     << "\t45\t33\t1\tpacked\t0\t4\t12\t0\t100\n";
+            }
+
+            WHEN("planning the shape")
+            {
+                Planner planner{tuningFile.path(), 1};
+                const auto matrix = integralMatrix(45, 33);
+                const auto plan = planner.plan(matrix);
+
+                THEN("the entry is ignored and the shape is tuned again")
+                {
+                    REQUIRE(planner.tuningRuns() == 1);
+
+                    const auto inputVector = integralVector(33);
+                    avx2::AVXVector result(45);
+                    plan.transform(inputVector, result);
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(avx2::transform(matrix, inputVector)
+                                            .packs()));
+                }
+            }
+        }
+
+        GIVEN("a tuning file that cannot be written")
+        {
+            Planner planner{"/nonexistent-directory/avx2-tuning.tsv", 1};
+            const auto matrix = integralMatrix(9, 17);
+
+            WHEN("planning a shape")
+            {
+                const auto plan = planner.plan(matrix);
+
+                THEN("the plan still transforms")
+                {
+                    const auto inputVector = integralVector(17);
+                    avx2::AVXVector result(9);
+                    plan.transform(inputVector, result);
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(avx2::transform(matrix, inputVector)
+                                            .packs()));
+                }
+            }
+        }
+    }
+}
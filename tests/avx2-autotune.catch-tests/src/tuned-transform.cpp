@@ -0,0 +1,81 @@
+#include "test_commons.h"
+
+#include <omp.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::autotune
+{
+    SCENARIO("Tuned transformations")
+    {
+        GIVEN("a matrix with partial panels and vectors")
+        {
+            const auto matrix = integralMatrix(77, 601);
+            const auto inputVector = integralVector(601);
+            const auto expected = avx2::transform(matrix, inputVector);
+
+            WHEN("transforming with each kernel and some tunables")
+            {
+                THEN("each result equals the transformation")
+                {
+                    for (const auto & choice :
+                         {TuningChoice{Kernel::TRANSFORM, 0, 0, 0, 16},
+                          TuningChoice{Kernel::TRANSFORM_MULTI_THREADED, 2},
+                          TuningChoice{Kernel::PACKED, 0, 4, 0},
+                          TuningChoice{Kernel::PACKED_MULTI_THREADED, 3, 8,
+                                       512},
+                          TuningChoice{Kernel::BATCH}})
+                    {
+                        const TunedTransform tuned{matrix, choice};
+                        avx2::AVXVector result(77, 5.0F);
+                        tuned.transform(inputVector, result);
+                        REQUIRE_THAT(result.packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("transforming a batch with each kernel")
+            {
+                const avx2::AVXVector otherVector(601, 1.0F);
+                const auto otherExpected = avx2::transform(matrix, otherVector);
+                const std::vector<const avx2::AVXVector *> inputs{
+                    &inputVector, &otherVector, &inputVector};
+
+                THEN("each result equals the transformation")
+                {
+                    for (const auto kernel :
+                         {Kernel::TRANSFORM, Kernel::PACKED, Kernel::BATCH})
+                    {
+                        TuningChoice choice{kernel};
+                        choice.rowPanelPacks = 8;
+                        const TunedTransform tuned{matrix, choice};
+                        const auto results = tuned.transform(inputs);
+                        REQUIRE(results.size() == 3);
+                        REQUIRE_THAT(results[0].packs(),
+                                     Equals(expected.packs()));
+                        REQUIRE_THAT(results[1].packs(),
+                                     Equals(otherExpected.packs()));
+                        REQUIRE_THAT(results[2].packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("running a multi-threaded kernel")
+            {
+                const auto threads = omp_get_max_threads();
+                const TunedTransform tuned{
+                    matrix,
+                    TuningChoice{Kernel::TRANSFORM_MULTI_THREADED, 2}};
+                avx2::AVXVector result(77);
+                tuned.transform(inputVector, result);
+
+                THEN("the default count of threads is unchanged")
+                {
+                    REQUIRE(omp_get_max_threads() == threads);
+                }
+            }
+        }
+    }
+}
@@ -3,3 +3,5 @@
 #include <avx2-model.h>
 
 #include <catch2/catch.hpp>
+
+#include <cmath>
@@ -0,0 +1,85 @@
+#include "test_commons.h"
+
+#include <avx2-arena.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 matrix and vector arenas")
+    {
+        GIVEN("a matrix arena with matrices of different shapes")
+        {
+            MatrixArena matrices;
+            const auto first = matrices.add(3, 2, 1.0F);
+
+            SOAMatrix matrix{9, 4};
+            matrix.at(8, 3) = 5.0F;
+            const auto second = matrices.add(matrix);
+
+            THEN("the matrices lie one after another in the packs")
+            {
+                REQUIRE(matrices.size() == 2);
+                REQUIRE(first == 0);
+                REQUIRE(second == 1);
+                REQUIRE(matrices.firstPack(first) == 0);
+                REQUIRE(matrices.firstPack(second) == 2);
+                REQUIRE(matrices.packs().size() == 2 + 2 * 4);
+            }
+
+            THEN("the elements keep their values and shapes")
+            {
+                REQUIRE(matrices.rows(first) == 3);
+                REQUIRE(matrices.columns(second) == 4);
+                REQUIRE(matrices.at(first, 2, 1) == 1.0F);
+                REQUIRE(matrices.at(second, 8, 3) == 5.0F);
+                REQUIRE(matrices.at(second, 7, 3) == 0.0F);
+            }
+
+            THEN("the columns are padded like in a SOAMatrix")
+            {
+                for (size_t lane{3}; lane < 8; ++lane)
+                {
+                    REQUIRE(std::signbit(matrices.packs()[1][lane]));
+                }
+                const auto begin =
+                    matrices.packs().cbegin() +
+                    static_cast<int64_t>(matrices.firstPack(second));
+                REQUIRE_THAT(std::vector<AVXPack>(begin, begin + 8),
+                             Equals(matrix.packs()));
+            }
+
+            WHEN("creating the result arena for them")
+            {
+                const auto results = resultArena(matrices);
+
+                THEN("it holds one zero vector per matrix of its rows")
+                {
+                    REQUIRE(results.size() == 2);
+                    REQUIRE(results.elements(0) == 3);
+                    REQUIRE(results.elements(1) == 9);
+                    REQUIRE(results.firstPack(1) == 1);
+                    REQUIRE(results.at(1, 8) == 0.0F);
+                    REQUIRE(std::signbit(results.packs()[2][1]));
+                }
+            }
+        }
+
+        GIVEN("a vector arena with a copied vector")
+        {
+            VectorArena vectors;
+            AVXVector vector(10);
+            vector.at(9) = 2.0F;
+            vectors.add(vector);
+            vectors.at(0, 0) = 1.0F;
+
+            THEN("its elements are accessible and its packs padded")
+            {
+                REQUIRE(vectors.elements(0) == 10);
+                REQUIRE(vectors.at(0, 0) == 1.0F);
+                REQUIRE(vectors.at(0, 9) == 2.0F);
+                REQUIRE(std::signbit(vectors.packs()[1][2]));
+            }
+        }
+    }
+}
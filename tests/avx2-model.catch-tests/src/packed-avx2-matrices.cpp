@@ -0,0 +1,84 @@
+#include "test_commons.h"
+
+#include <avx2-packed-model.h>
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 matrices packed into kernel order")
+    {
+        GIVEN("a matrix with partial row and column panels")
+        {
+            // 5 row packs and 21 columns.
+            SOAMatrix matrix{37, 21};
+            for (size_t c{0}; c < 21; ++c)
+            {
+                for (size_t r{0}; r < 37; ++r)
+                {
+                    matrix.at(r, c) = static_cast<float>(r * 100 + c);
+                }
+            }
+
+            WHEN("packing it with row panels of 2 packs and column panels of "
+                 "8 columns")
+            {
+                const PackedMatrix packed{matrix, PackedBlocking{2, 8}};
+
+                THEN("it keeps the shape, the elements and the pack count")
+                {
+                    REQUIRE(packed.rows() == 37);
+                    REQUIRE(packed.columns() == 21);
+                    REQUIRE(packed.rowPanels() == 3);
+                    REQUIRE(packed.columnPanels() == 3);
+                    REQUIRE(packed.packs().size() == matrix.packs().size());
+                    for (size_t c{0}; c < 21; ++c)
+                    {
+                        for (size_t r{0}; r < 37; ++r)
+                        {
+                            REQUIRE(packed.at(r, c) == matrix.at(r, c));
+                        }
+                    }
+                }
+
+                THEN("the panels lie in the order of their consumption")
+                {
+                    // The first row panel holds 2 packs of each of the 8
+                    // columns of the first column panel.
+                    REQUIRE(packed.firstPack(0, 1) == 16);
+                    REQUIRE(packed.packs()[0][0] == 0.0F);
+                    REQUIRE(packed.packs()[1][0] == 800.0F);
+                    REQUIRE(packed.packs()[2][0] == 1.0F);
+
+                    // The last row panel of a column panel holds 1 pack.
+                    REQUIRE(packed.firstPack(0, 2) == 32);
+                    REQUIRE(packed.packs()[33][0] == 3201.0F);
+
+                    // The last column panel holds the 5 remaining columns.
+                    REQUIRE(packed.firstPack(2, 0) == 16 * 5);
+                    REQUIRE(packed.firstPack(2, 1) == 16 * 5 + 2 * 5);
+                    REQUIRE(packed.packs()[16 * 5][0] == 16.0F);
+                }
+
+                THEN("the padding is kept")
+                {
+                    REQUIRE(std::signbit(packed.packs()[32][5]));
+                    REQUIRE(packed.packs()[32][5] == 0.0F);
+                }
+            }
+
+            WHEN("packing it with the default blocking")
+            {
+                const PackedMatrix packed{matrix};
+
+                THEN("all columns form one column panel")
+                {
+                    REQUIRE(packed.blocking().rowPanelPacks ==
+                            PACKED_MAX_ROW_PANEL_PACKS);
+                    REQUIRE(packed.columnPanels() == 1);
+                    REQUIRE(packed.rowPanels() == 1);
+                    REQUIRE(packed.at(36, 20) == 3620.0F);
+                    REQUIRE(packed.packs()[5][0] == 1.0F);
+                }
+            }
+        }
+    }
+}
@@ -80,5 +80,52 @@ namespace matrixmultiplication::avx2
                 }
             }
         }
+
+        GIVEN("a vector shrunk from 20 to 11 elements")
+        {
+            const auto vector = [] {
+                AVXVector v(20, 1.0F);
+                v.resize(11);
+                return v;
+            }();
+
+            WHEN("querying the sizes")
+            {
+                const auto actualSize = vector.size();
+                const auto actualPackSize = vector.packs().size();
+
+                THEN("it returns 11 elements in 2 packs")
+                {
+                    REQUIRE(actualSize == 11);
+                    REQUIRE(actualPackSize == 2);
+                }
+            }
+
+            WHEN("querying the kept and the padded values")
+            {
+                const auto keptValue = vector.at(10);
+                const auto paddedValue = vector.at(11);
+
+                THEN("it keeps the elements and restores the padding")
+                {
+                    REQUIRE(keptValue == 1.0F);
+                    REQUIRE(std::signbit(paddedValue));
+                    REQUIRE(paddedValue == PADDING_VALUE);
+                }
+            }
+
+            WHEN("growing it again to 20 elements")
+            {
+                auto grown = vector;
+                grown.resize(20);
+
+                THEN("the new elements have the initial value")
+                {
+                    REQUIRE(grown.at(10) == 1.0F);
+                    REQUIRE(grown.at(11) == AVXVector::INITIAL_VALUE);
+                    REQUIRE(grown.at(19) == AVXVector::INITIAL_VALUE);
+                }
+            }
+        }
     }
 } // namespace matrixmultiplication::scalar
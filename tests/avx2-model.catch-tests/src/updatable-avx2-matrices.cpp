@@ -0,0 +1,95 @@
+#include "test_commons.h"
+
+#include <avx2-matrix-updates.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("updatable AVX2 matrices")
+    {
+        GIVEN("a matrix with padded rows and two vectors")
+        {
+            SOAMatrix matrix{11, 3, 1.0F};
+
+            AVXVector u(11);
+            for (size_t i{0}; i < u.size(); ++i)
+            {
+                u.at(i) = static_cast<float>(i);
+            }
+
+            AVXVector v(3);
+            v.at(0) = 1.0F;
+            v.at(1) = -2.0F;
+            v.at(2) = 0.5F;
+
+            WHEN("applying the rank-1 update with u and v")
+            {
+                ger(matrix, 2.0F, u, v);
+
+                THEN("each element is increased by alpha * u[r] * v[c]")
+                {
+                    SOAMatrix expected{11, 3};
+                    for (size_t r{0}; r < 11; ++r)
+                    {
+                        for (size_t c{0}; c < 3; ++c)
+                        {
+                            expected.at(r, c) = 1.0F + 2.0F * u.at(r) * v.at(c);
+                        }
+                    }
+
+                    REQUIRE_THAT(matrix.packs(), Equals(expected.packs()));
+                }
+
+                THEN("the padding is kept")
+                {
+                    for (size_t i{3}; i < NUM_FLOATS_PER_AVX_REGISTER; ++i)
+                    {
+                        REQUIRE(std::signbit(matrix.packs()[1][i]));
+                        REQUIRE(std::signbit(matrix.packs()[5][i]));
+                    }
+                }
+            }
+
+            WHEN("replacing its second column by u")
+            {
+                replaceColumn(matrix, 1, u);
+
+                THEN("only the second column holds the values of u")
+                {
+                    for (size_t r{0}; r < 11; ++r)
+                    {
+                        REQUIRE(matrix.at(r, 0) == 1.0F);
+                        REQUIRE(matrix.at(r, 1) == u.at(r));
+                        REQUIRE(matrix.at(r, 2) == 1.0F);
+                    }
+                }
+
+                THEN("the padding is kept")
+                {
+                    for (size_t i{3}; i < NUM_FLOATS_PER_AVX_REGISTER; ++i)
+                    {
+                        REQUIRE(std::signbit(matrix.packs()[3][i]));
+                    }
+                }
+            }
+
+            WHEN("replacing its tenth row by v")
+            {
+                replaceRow(matrix, 9, v);
+
+                THEN("only the tenth row holds the values of v")
+                {
+                    for (size_t r{0}; r < 11; ++r)
+                    {
+                        for (size_t c{0}; c < 3; ++c)
+                        {
+                            REQUIRE(matrix.at(r, c) ==
+                                    (r == 9 ? v.at(c) : 1.0F));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <avx2-solvers.h>
+#include <avx2-variant.h>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+namespace matrixmultiplication::solvers
+{
+    // A matrix with the diagonal 1 + i and small off-diagonal elements,
+    // which is diagonally dominant and, if symmetric, positive definite.
+    inline avx2::SOAMatrix wellConditionedMatrix(const size_t size,
+                                                 const bool symmetric)
+    {
+        avx2::SOAMatrix m{size, size};
+        for (size_t c{0}; c < size; ++c)
+        {
+            for (size_t r{0}; r < size; ++r)
+            {
+                const auto seed = symmetric ? r * c + r + c : r * 3 + c;
+                m.at(r, c) =
+                    r == c ? 1.0F + static_cast<float>(r)
+                           : (static_cast<float>(seed % 7) - 3.0F) /
+                                 (4.0F * static_cast<float>(size));
+            }
+        }
+        return m;
+    }
+
+    inline avx2::AVXVector rampVector(const size_t size)
+    {
+        avx2::AVXVector v(size);
+        for (size_t i{0}; i < size; ++i)
+        {
+            v.at(i) = static_cast<float>(i % 5) - 2.0F;
+        }
+        return v;
+    }
+
+    // |b - Ax| / |b|, computed independently of the solvers.
+    inline float relativeResidual(const avx2::SOAMatrix & matrix,
+                                  const avx2::AVXVector & rightHandSide,
+                                  const avx2::AVXVector & solution)
+    {
+        const auto product = avx2::transform(matrix, solution);
+        double residual{0.0};
+        double norm{0.0};
+        for (size_t i{0}; i < rightHandSide.size(); ++i)
+        {
+            const double difference = rightHandSide.at(i) - product.at(i);
+            residual += difference * difference;
+            norm += double{rightHandSide.at(i)} * rightHandSide.at(i);
+        }
+        return static_cast<float>(std::sqrt(residual / norm));
+    }
+}
@@ -0,0 +1,79 @@
+#include "test_commons.h"
+
+namespace matrixmultiplication::solvers
+{
+    SCENARIO("conjugate gradient solver")
+    {
+        GIVEN("a symmetric positive definite system")
+        {
+            const auto matrix = wellConditionedMatrix(50, true);
+            const auto rightHandSide = rampVector(50);
+            ConjugateGradient solver{50};
+
+            WHEN("solving it from a zero guess")
+            {
+                avx2::AVXVector solution(50);
+                const auto result = solver.solve(matrix, rightHandSide,
+                                                 solution, {200, 1e-5F});
+
+                THEN("it converges to the solution")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(result.iterations > 0);
+                    REQUIRE(result.residual < 1e-5F);
+                    REQUIRE(relativeResidual(matrix, rightHandSide, solution) <
+                            1e-4F);
+                    REQUIRE(std::signbit(solution.at(50)));
+                }
+            }
+
+            WHEN("solving it with the multi-threaded products")
+            {
+                avx2::AVXVector solution(50);
+                const auto result = solver.solve(matrix, rightHandSide,
+                                                 solution, {200, 1e-5F, true});
+
+                THEN("it converges to the solution")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(relativeResidual(matrix, rightHandSide, solution) <
+                            1e-4F);
+                }
+            }
+
+            WHEN("solving it with too few iterations")
+            {
+                avx2::AVXVector solution(50);
+                const auto result = solver.solve(matrix, rightHandSide,
+                                                 solution, {2, 1e-7F});
+
+                THEN("it stops without convergence")
+                {
+                    REQUIRE_FALSE(result.converged);
+                    REQUIRE(result.iterations == 2);
+                }
+            }
+        }
+
+        GIVEN("a homogeneous system")
+        {
+            const auto matrix = wellConditionedMatrix(9, true);
+            const avx2::AVXVector rightHandSide(9);
+            ConjugateGradient solver{9};
+
+            WHEN("solving it from a non-zero guess")
+            {
+                avx2::AVXVector solution(9, 1.0F);
+                const auto result =
+                    solver.solve(matrix, rightHandSide, solution);
+
+                THEN("the solution is zero without iterating")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(result.iterations == 0);
+                    REQUIRE(solution.at(8) == 0.0F);
+                }
+            }
+        }
+    }
+}
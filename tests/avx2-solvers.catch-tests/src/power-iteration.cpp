@@ -0,0 +1,65 @@
+#include "test_commons.h"
+
+namespace matrixmultiplication::solvers
+{
+    SCENARIO("power iteration")
+    {
+        GIVEN("a diagonal matrix with a dominant element")
+        {
+            avx2::SOAMatrix matrix{12, 12};
+            for (size_t i{0}; i < 12; ++i)
+            {
+                matrix.at(i, i) = static_cast<float>(i + 1);
+            }
+            matrix.at(5, 5) = -30.0F;
+            PowerIteration solver{12};
+
+            WHEN("iterating from a vector of ones")
+            {
+                avx2::AVXVector eigenvector(12, 1.0F);
+                float eigenvalue{0.0F};
+                const auto result =
+                    solver.solve(matrix, eigenvector, eigenvalue, {500, 1e-6F});
+
+                THEN("it finds the dominant eigenvalue and eigenvector")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(eigenvalue == Approx(-30.0F).epsilon(1e-5));
+                    REQUIRE(std::abs(eigenvector.at(5)) ==
+                            Approx(1.0F).epsilon(1e-4));
+                    REQUIRE(std::abs(eigenvector.at(11)) < 1e-3F);
+                    REQUIRE(std::signbit(eigenvector.at(12)));
+                }
+            }
+        }
+
+        GIVEN("a symmetric matrix with a separated dominant eigenvalue")
+        {
+            // The convergence of the eigenvalue estimate only bounds the
+            // error of the eigenvector if the eigenvalues are well apart.
+            auto matrix = wellConditionedMatrix(30, true);
+            matrix.at(29, 29) = 60.0F;
+            PowerIteration solver{30};
+
+            WHEN("iterating with the multi-threaded products")
+            {
+                avx2::AVXVector eigenvector = rampVector(30);
+                float eigenvalue{0.0F};
+                const auto result = solver.solve(
+                    matrix, eigenvector, eigenvalue, {5000, 1e-6F, true});
+
+                THEN("the eigenvector satisfies Av = lambda v")
+                {
+                    REQUIRE(result.converged);
+                    const auto product = avx2::transform(matrix, eigenvector);
+                    for (size_t i{0}; i < 30; ++i)
+                    {
+                        REQUIRE(product.at(i) ==
+                                Approx(eigenvalue * eigenvector.at(i))
+                                    .margin(2e-2));
+                    }
+                }
+            }
+        }
+    }
+}
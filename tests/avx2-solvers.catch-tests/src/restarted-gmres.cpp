@@ -0,0 +1,44 @@
+#include "test_commons.h"
+
+namespace matrixmultiplication::solvers
+{
+    SCENARIO("restarted GMRES solver")
+    {
+        GIVEN("a non-symmetric system")
+        {
+            const auto matrix = wellConditionedMatrix(40, false);
+            const auto rightHandSide = rampVector(40);
+
+            WHEN("solving it without restarts")
+            {
+                RestartedGmres solver{40, 40};
+                avx2::AVXVector solution(40);
+                const auto result = solver.solve(matrix, rightHandSide,
+                                                 solution, {200, 1e-5F});
+
+                THEN("it converges to the solution")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(relativeResidual(matrix, rightHandSide, solution) <
+                            1e-4F);
+                }
+            }
+
+            WHEN("solving it with restarts after few iterations")
+            {
+                RestartedGmres solver{40, 4};
+                avx2::AVXVector solution(40);
+                const auto result = solver.solve(matrix, rightHandSide,
+                                                 solution, {400, 1e-5F, true});
+
+                THEN("it still converges to the solution")
+                {
+                    REQUIRE(result.converged);
+                    REQUIRE(result.iterations > 4);
+                    REQUIRE(relativeResidual(matrix, rightHandSide, solution) <
+                            1e-4F);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <avx2-chunk-channel.h>
+#include <avx2-streaming.h>
+#include <avx2-test-fixtures.h>
+#include <avx2-variant.h>
+
+#include <catch2/catch.hpp>
@@ -0,0 +1,122 @@
+#include "test_commons.h"
+
+#include <thread>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 streaming transformation")
+    {
+        const auto matrix = integralMatrix(13, 21);
+        const auto inputVector = integralVector(21);
+
+        std::vector<float> input(21);
+        for (size_t i{0}; i < input.size(); ++i)
+        {
+            input[i] = inputVector.at(i);
+        }
+
+        const auto expected = transform(matrix, inputVector);
+
+        GIVEN("a streaming transformation consuming pack by pack")
+        {
+            StreamingTransform streamingTransform{matrix};
+
+            WHEN("consuming all but the last pack")
+            {
+                streamingTransform.consume(inputVector.packs()[0]);
+                streamingTransform.consume(inputVector.packs()[1]);
+
+                THEN("it is not complete yet")
+                {
+                    REQUIRE_FALSE(streamingTransform.complete());
+                }
+
+                AND_WHEN("consuming the last pack")
+                {
+                    streamingTransform.consume(inputVector.packs()[2]);
+
+                    THEN("the result equals the plain transformation")
+                    {
+                        REQUIRE(streamingTransform.complete());
+                        REQUIRE_THAT(streamingTransform.result().packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+        }
+
+        GIVEN("a producer thread writing odd-sized chunks into a channel")
+        {
+            ChunkChannel channel;
+            std::thread producer{[&]() {
+                for (size_t i{0}; i < input.size(); i += 5)
+                {
+                    channel.write(std::vector<float>(
+                        input.begin() + static_cast<std::ptrdiff_t>(i),
+                        input.begin() + static_cast<std::ptrdiff_t>(
+                                            std::min(i + 5, input.size()))));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                channel.close();
+            }};
+
+            WHEN("transforming the stream of packs reassembled from it")
+            {
+                const auto result =
+                    transformStream(matrix, packsOf(channel, input.size()));
+                producer.join();
+
+                THEN("the result equals the plain transformation")
+                {
+                    REQUIRE(result.has_value());
+                    REQUIRE_THAT(result->packs(), Equals(expected.packs()));
+                }
+            }
+        }
+
+        GIVEN("a producer thread closing the channel after 12 of 21 elements")
+        {
+            ChunkChannel channel;
+            std::thread producer{[&]() {
+                channel.write(std::vector<float>(input.begin(),
+                                                 input.begin() + 12));
+                channel.close();
+            }};
+
+            WHEN("transforming the stream of packs reassembled from it")
+            {
+                const auto result =
+                    transformStream(matrix, packsOf(channel, input.size()));
+                producer.join();
+
+                THEN("there is no result")
+                {
+                    REQUIRE_FALSE(result.has_value());
+                }
+            }
+        }
+
+        GIVEN("a channel with all chunks written up front")
+        {
+            ChunkChannel channel;
+            channel.write(std::vector<float>(input.begin(), input.end()));
+            channel.close();
+
+            WHEN("drawing the packs from it")
+            {
+                std::vector<AVXPack> packs;
+                for (auto && pack : packsOf(channel, input.size()))
+                {
+                    packs.push_back(pack);
+                }
+
+                THEN("they equal the padded packs of the input vector")
+                {
+                    REQUIRE_THAT(packs, Equals(inputVector.packs()));
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,15 @@
 #pragma once
 
+#include <avx2-arena-transform.h>
+#include <avx2-blas1-mt.h>
+#include <avx2-blas1.h>
+#include <avx2-gemm.h>
+#include <avx2-packed.h>
+#include <avx2-plan.h>
+#include <avx2-test-fixtures.h>
 #include <avx2-variant-mt.h>
+#include <avx2-variant.h>
 
 #include <catch2/catch.hpp>
+
+#include <cmath>
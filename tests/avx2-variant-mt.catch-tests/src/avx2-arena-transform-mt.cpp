@@ -0,0 +1,57 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 arena transformation multi-threaded")
+    {
+        GIVEN("arenas of more pairs than threads of uneven sizes")
+        {
+            MatrixArena matrices;
+            VectorArena inputs;
+            for (size_t m{0}; m < 57; ++m)
+            {
+                const auto rows = 16 + (m * 37) % 241;
+                const auto columns = 1 + (m * 11) % 29;
+                const auto index = matrices.add(rows, columns);
+                inputs.add(columns);
+                for (size_t c{0}; c < columns; ++c)
+                {
+                    inputs.at(index, c) = static_cast<float>(c % 3) - 1.0F;
+                    for (size_t r{0}; r < rows; ++r)
+                    {
+                        matrices.at(index, r, c) =
+                            static_cast<float>((r + m + c) % 5) - 2.0F;
+                    }
+                }
+            }
+
+            WHEN("transforming all pairs multi-threaded")
+            {
+                auto results = resultArena(matrices);
+                transformArenaMultiThreaded(matrices, inputs, results);
+
+                THEN("the results equal the single-threaded ones")
+                {
+                    auto expected = resultArena(matrices);
+                    transformArena(matrices, inputs, expected);
+                    REQUIRE_THAT(results.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+
+        GIVEN("empty arenas")
+        {
+            const MatrixArena matrices;
+            const VectorArena inputs;
+            auto results = resultArena(matrices);
+
+            THEN("transforming them does nothing")
+            {
+                transformArenaMultiThreaded(matrices, inputs, results);
+                REQUIRE(results.size() == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#include "test_commons.h"
+
+#include <omp.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 level-1 vector operations multi-threaded")
+    {
+        GIVEN("two vectors of inexact values over many reduction blocks")
+        {
+            constexpr size_t size{REDUCTION_BLOCK_PACKS * 8 * 7 + 5};
+            AVXVector x(size);
+            AVXVector y(size);
+            for (size_t i{0}; i < size; ++i)
+            {
+                x.at(i) = 1.0F / static_cast<float>(i + 1);
+                y.at(i) = std::sin(static_cast<float>(i));
+            }
+
+            WHEN("reducing them with different counts of threads")
+            {
+                const auto threads = omp_get_max_threads();
+
+                THEN("the results equal the single-threaded ones bit by bit")
+                {
+                    for (auto t : {1, 2, 3, 5, 8})
+                    {
+                        omp_set_num_threads(t);
+                        REQUIRE(dotMultiThreaded(x, y) == dot(x, y));
+                        REQUIRE(normMultiThreaded(y) == norm(y));
+                        REQUIRE(dotAndSquaredNormMultiThreaded(x, y) ==
+                                dotAndSquaredNorm(x, y));
+
+                        auto expected = y;
+                        const auto expectedSquaredNorm =
+                            axpbyAndSquaredNorm(0.5F, x, -1.5F, expected);
+                        auto updated = y;
+                        REQUIRE(axpbyAndSquaredNormMultiThreaded(
+                                    0.5F, x, -1.5F, updated) ==
+                                expectedSquaredNorm);
+                        REQUIRE_THAT(updated.packs(),
+                                     Equals(expected.packs()));
+                    }
+                    omp_set_num_threads(threads);
+                }
+            }
+
+            WHEN("applying the element-wise operations multi-threaded")
+            {
+                auto scaled = x;
+                scaleMultiThreaded(-3.0F, scaled);
+                auto updated = y;
+                axpyMultiThreaded(2.0F, x, updated);
+                AVXVector sum(size);
+                addMultiThreaded(x, y, sum);
+                AVXVector product(size);
+                multiplyElementwiseMultiThreaded(x, y, product);
+
+                THEN("they equal the single-threaded operations")
+                {
+                    auto expectedScaled = x;
+                    scale(-3.0F, expectedScaled);
+                    auto expectedUpdated = y;
+                    axpy(2.0F, x, expectedUpdated);
+                    AVXVector expectedSum(size);
+                    add(x, y, expectedSum);
+                    AVXVector expectedProduct(size);
+                    multiplyElementwise(x, y, expectedProduct);
+
+                    REQUIRE_THAT(scaled.packs(),
+                                 Equals(expectedScaled.packs()));
+                    REQUIRE_THAT(updated.packs(),
+                                 Equals(expectedUpdated.packs()));
+                    REQUIRE_THAT(sum.packs(), Equals(expectedSum.packs()));
+                    REQUIRE_THAT(product.packs(),
+                                 Equals(expectedProduct.packs()));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include "test_commons.h"
+
+#include <omp.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 matrix-matrix multiplication multi-threaded")
+    {
+        GIVEN("matrices with more column tiles than threads")
+        {
+            SOAMatrix a{45, 70};
+            SOAMatrix b{70, 101};
+            for (size_t c{0}; c < 70; ++c)
+            {
+                for (size_t r{0}; r < 45; ++r)
+                {
+                    a.at(r, c) = static_cast<float>((r + c) % 5) - 2.0F;
+                }
+                for (size_t r{0}; r < 101; ++r)
+                {
+                    b.at(c, r) = static_cast<float>((r * c) % 3) - 1.0F;
+                }
+            }
+
+            WHEN("multiplying them multi-threaded")
+            {
+                const auto result = multiplyMultiThreaded(a, b);
+
+                THEN("it equals the single-threaded product")
+                {
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(multiply(a, b).packs()));
+                }
+            }
+        }
+
+        GIVEN("matrices with fewer column tiles than threads")
+        {
+            SOAMatrix a{3, 2, 1.0F};
+            SOAMatrix b{2, 4, 2.0F};
+
+            WHEN("multiplying them multi-threaded")
+            {
+                const auto result = multiplyMultiThreaded(a, b);
+
+                THEN("it equals the single-threaded product")
+                {
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(multiply(a, b).packs()));
+                }
+            }
+        }
+
+        GIVEN("matrices with several row blocks of A and panels of B")
+        {
+            // 38 row packs and a depth of two panels.
+            const auto a = integralMatrix(300, 300);
+            const auto b = integralMatrix(300, 20);
+
+            WHEN("multiplying them with 1 to 5 threads")
+            {
+                const auto expected = multiply(a, b);
+                const auto threads = omp_get_max_threads();
+
+                THEN("each product equals the single-threaded one")
+                {
+                    for (auto t : {1, 2, 3, 4, 5})
+                    {
+                        omp_set_num_threads(t);
+                        REQUIRE_THAT(multiplyMultiThreaded(a, b).packs(),
+                                     Equals(expected.packs()));
+                    }
+                    omp_set_num_threads(threads);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 rank-1 update multi-threaded")
+    {
+        GIVEN("a matrix with more columns than threads and two vectors")
+        {
+            SOAMatrix matrix{13, 37, 1.0F};
+
+            AVXVector u(13);
+            for (size_t i{0}; i < u.size(); ++i)
+            {
+                u.at(i) = static_cast<float>(i % 4);
+            }
+
+            AVXVector v(37);
+            for (size_t i{0}; i < v.size(); ++i)
+            {
+                v.at(i) = static_cast<float>(i % 3) - 1.0F;
+            }
+
+            WHEN("applying the rank-1 update multi-threaded")
+            {
+                auto expected = matrix;
+                ger(expected, 0.5F, u, v);
+
+                gerMultiThreaded(matrix, 0.5F, u, v);
+
+                THEN("it equals the single-threaded update")
+                {
+                    REQUIRE_THAT(matrix.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+    }
+}
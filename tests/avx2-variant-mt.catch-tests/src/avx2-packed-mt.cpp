@@ -0,0 +1,41 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 transformation by packed matrices multi-threaded")
+    {
+        GIVEN("a packed matrix with more row panels than threads")
+        {
+            SOAMatrix matrix{333, 50};
+            for (size_t c{0}; c < 50; ++c)
+            {
+                for (size_t r{0}; r < 333; ++r)
+                {
+                    matrix.at(r, c) = std::sin(static_cast<float>(r + c * 3));
+                }
+            }
+            const PackedMatrix packed{matrix, PackedBlocking{2, 24}};
+
+            AVXVector inputVector(50);
+            for (size_t i{0}; i < 50; ++i)
+            {
+                inputVector.at(i) = 1.0F / static_cast<float>(i + 1);
+            }
+
+            WHEN("transforming by it multi-threaded")
+            {
+                const auto result =
+                    transformPackedMultiThreaded(packed, inputVector);
+
+                THEN("it equals the single-threaded transformation")
+                {
+                    REQUIRE_THAT(
+                        result.packs(),
+                        Equals(transformPacked(packed, inputVector).packs()));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 transformation by plans multi-threaded")
+    {
+        GIVEN("matrices of small and large shapes and vectors")
+        {
+            const std::pair<size_t, size_t> shapes[]{
+                {9, 20}, {64, 33}, {333, 129}};
+
+            WHEN("executing plans with several counts of threads")
+            {
+                THEN("each result equals the transformation")
+                {
+                    for (const auto & [rows, columns] : shapes)
+                    {
+                        const auto matrix = integralMatrix(rows, columns);
+                        const auto inputVector = integralVector(columns);
+                        const auto expected = transform(matrix, inputVector);
+
+                        for (const size_t threads : {1, 2, 3, 5})
+                        {
+                            for (const auto kernel :
+                                 {PlanKernel::COLUMN_PASSES,
+                                  PlanKernel::REGISTER_BLOCKED})
+                            {
+                                PlanOptions options{};
+                                options.kernel = kernel;
+                                options.threads = threads;
+                                const TransformPlan plan{rows, columns,
+                                                         options};
+
+                                AVXVector result(rows, 5.0F);
+                                executeMultiThreaded(plan, matrix,
+                                                     inputVector, result);
+                                REQUIRE_THAT(result.packs(),
+                                             Equals(expected.packs()));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
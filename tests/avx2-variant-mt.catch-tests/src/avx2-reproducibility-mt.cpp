@@ -0,0 +1,157 @@
+#include "test_commons.h"
+
+#include <omp.h>
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        // Values of many magnitudes, so that the rounding of the sums
+        // depends on the order of the additions.
+        SOAMatrix inexactMatrix(const size_t rows, const size_t columns)
+        {
+            SOAMatrix m{rows, columns};
+            for (size_t c{0}; c < columns; ++c)
+            {
+                for (size_t r{0}; r < rows; ++r)
+                {
+                    m.at(r, c) =
+                        std::sin(static_cast<float>(r * 31 + c)) *
+                        std::exp2(static_cast<float>((r + c * 7) % 17) - 8.0F);
+                }
+            }
+            return m;
+        }
+
+        AVXVector inexactVector(const size_t size)
+        {
+            AVXVector v(size);
+            for (size_t i{0}; i < size; ++i)
+            {
+                v.at(i) = 1.0F / static_cast<float>(i + 3);
+            }
+            return v;
+        }
+
+        constexpr int THREAD_COUNTS[]{1, 2, 3, 4, 7};
+    }
+
+    SCENARIO("AVX2 transformation multi-threaded reproducibility")
+    {
+        GIVEN("a tall matrix of inexact values")
+        {
+            const auto matrix = inexactMatrix(517, 45);
+            const auto inputVector = inexactVector(45);
+
+            WHEN("transforming with the row panels and different counts of "
+                 "threads")
+            {
+                const auto threads = omp_get_max_threads();
+
+                THEN("the results equal the single-threaded one bit by bit")
+                {
+                    omp_set_num_threads(1);
+                    const auto expected =
+                        transformMultiThreaded(matrix, inputVector);
+                    for (auto t : THREAD_COUNTS)
+                    {
+                        omp_set_num_threads(t);
+                        REQUIRE_THAT(
+                            transformMultiThreaded(matrix, inputVector)
+                                .packs(),
+                            Equals(expected.packs()));
+                    }
+                    omp_set_num_threads(threads);
+                }
+            }
+        }
+
+        GIVEN("a wide matrix of inexact values with few rows")
+        {
+            const size_t rows{13};
+            const size_t columns{5000};
+            const auto matrix = inexactMatrix(rows, columns);
+            const auto inputVector = inexactVector(columns);
+            const auto reference = transform(matrix, inputVector);
+
+            TransformOptions reproducible{};
+            reproducible.reductionMode = ReductionMode::REPRODUCIBLE;
+
+            WHEN("splitting the columns reproducibly with different counts "
+                 "of threads")
+            {
+                const auto threads = omp_get_max_threads();
+
+                THEN("the results are equal bit by bit and close to the "
+                     "single-threaded transformation")
+                {
+                    omp_set_num_threads(1);
+                    const auto expected = transformSplitColumnsMultiThreaded(
+                        matrix, inputVector, reproducible);
+                    for (auto t : THREAD_COUNTS)
+                    {
+                        omp_set_num_threads(t);
+                        REQUIRE_THAT(transformSplitColumnsMultiThreaded(
+                                         matrix, inputVector, reproducible)
+                                         .packs(),
+                                     Equals(expected.packs()));
+                    }
+                    omp_set_num_threads(threads);
+
+                    for (size_t r{0}; r < rows; ++r)
+                    {
+                        REQUIRE(expected.at(r) ==
+                                Approx(reference.at(r)).margin(1e-4));
+                    }
+                }
+            }
+
+            WHEN("splitting the columns in the fast mode")
+            {
+                const auto result =
+                    transformSplitColumnsMultiThreaded(matrix, inputVector);
+
+                THEN("the result is close to the single-threaded "
+                     "transformation")
+                {
+                    for (size_t r{0}; r < rows; ++r)
+                    {
+                        REQUIRE(result.at(r) ==
+                                Approx(reference.at(r)).margin(1e-4));
+                    }
+                }
+            }
+        }
+
+        GIVEN("a wide matrix of integral values and a bias")
+        {
+            const auto matrix = integralMatrix(21, 3001);
+            const auto inputVector = integralVector(3001);
+            const auto bias = integralVector(21);
+
+            WHEN("splitting the columns with negation, bias and ReLU in "
+                 "either mode")
+            {
+                TransformOptions options{Epilogue{-1.0F, &bias, 0.0F}};
+                const auto fast =
+                    transformSplitColumnsMultiThreaded(matrix, inputVector,
+                                                       options);
+                options.reductionMode = ReductionMode::REPRODUCIBLE;
+                const auto reproducible =
+                    transformSplitColumnsMultiThreaded(matrix, inputVector,
+                                                       options);
+
+                THEN("both equal the single-threaded transformation")
+                {
+                    const auto expected =
+                        transform(matrix, inputVector, options);
+                    REQUIRE_THAT(fast.packs(), Equals(expected.packs()));
+                    REQUIRE_THAT(reproducible.packs(),
+                                 Equals(expected.packs()));
+                }
+            }
+        }
+    }
+}
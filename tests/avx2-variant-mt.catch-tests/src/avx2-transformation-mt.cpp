@@ -137,5 +137,73 @@ namespace matrixmultiplication::avx2
                 }
             }
         }
+
+        GIVEN("a matrix with many more row panels than threads")
+        {
+            // Integral components keep the sums exact in any order.
+            const size_t rows{1003};
+            const size_t columns{37};
+
+            const auto sampleVector = [&]() {
+                AVXVector v(columns);
+                for (size_t c{0}; c < columns; ++c)
+                {
+                    v.at(c) = static_cast<float>(c % 3);
+                }
+                return v;
+            }();
+
+            const auto matrix = [&]() {
+                SOAMatrix m{rows, columns};
+                for (size_t r{0}; r < rows; ++r)
+                {
+                    for (size_t c{0}; c < columns; ++c)
+                    {
+                        m.at(r, c) = static_cast<float>((r + c) % 5);
+                    }
+                }
+                return m;
+            }();
+
+            WHEN("transforming the vector by the matrix")
+            {
+                const auto result =
+                    transformMultiThreaded(matrix, sampleVector);
+
+                THEN("each row panel results in the dot products of its rows")
+                {
+                    const auto expectedVector = [&]() {
+                        AVXVector v(rows);
+                        for (size_t r{0}; r < rows; ++r)
+                        {
+                            auto sum = 0.0F;
+                            for (size_t c{0}; c < columns; ++c)
+                            {
+                                sum += matrix.at(r, c) * sampleVector.at(c);
+                            }
+                            v.at(r) = sum;
+                        }
+                        return v;
+                    }();
+
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(expectedVector.packs()));
+                }
+            }
+
+            WHEN("transforming the vector into a reused result vector")
+            {
+                AVXVector result(rows, 5.0F);
+                transformMultiThreaded(matrix, sampleVector, result);
+
+                THEN("the previous content is overwritten")
+                {
+                    REQUIRE_THAT(
+                        result.packs(),
+                        Equals(transformMultiThreaded(matrix, sampleVector)
+                                   .packs()));
+                }
+            }
+        }
     }
 } // namespace matrixmultiplication::scalar
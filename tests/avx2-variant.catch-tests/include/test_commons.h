@@ -1,5 +1,21 @@
 #pragma once
 
+#include <avx2-arena-transform.h>
+#include <avx2-batch.h>
+#include <avx2-blas1.h>
+#include <avx2-chain.h>
+#include <avx2-fixed-variant.h>
+#include <avx2-gemm.h>
+#include <avx2-incremental.h>
+#include <avx2-packed.h>
+#include <avx2-plan.h>
+#include <avx2-small.h>
+#include <avx2-sparse.h>
+#include <avx2-test-fixtures.h>
 #include <avx2-variant.h>
+#include <scalar-variant.h>
 
 #include <catch2/catch.hpp>
+
+#include <cmath>
+#include <limits>
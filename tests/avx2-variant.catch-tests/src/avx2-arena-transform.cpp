@@ -0,0 +1,67 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 arena transformation")
+    {
+        GIVEN("arenas of matrices of different shapes and their inputs")
+        {
+            // Row counts below, at and above the register blocks.
+            const size_t shapes[][2]{
+                {16, 5}, {3, 17}, {64, 8}, {65, 2}, {137, 11}, {256, 4}};
+
+            std::vector<SOAMatrix> sampleMatrices;
+            std::vector<AVXVector> sampleVectors;
+            MatrixArena matrices;
+            VectorArena inputs;
+            for (auto && shape : shapes)
+            {
+                sampleMatrices.push_back(integralMatrix(shape[0], shape[1]));
+                sampleVectors.push_back(integralVector(shape[1]));
+                matrices.add(sampleMatrices.back());
+                inputs.add(sampleVectors.back());
+            }
+
+            WHEN("transforming all pairs into a result arena")
+            {
+                auto results = resultArena(matrices);
+                transformArena(matrices, inputs, results);
+
+                THEN("each result equals the single transformation")
+                {
+                    for (size_t m{0}; m < matrices.size(); ++m)
+                    {
+                        const auto expected =
+                            transform(sampleMatrices[m], sampleVectors[m]);
+                        const auto begin =
+                            results.packs().cbegin() +
+                            static_cast<int64_t>(results.firstPack(m));
+                        REQUIRE_THAT(
+                            std::vector<AVXPack>(
+                                begin,
+                                begin + static_cast<int64_t>(
+                                            expected.packs().size())),
+                            Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("transforming a range of the pairs")
+            {
+                auto results = resultArena(matrices);
+                transformArena(matrices, inputs, results, 1, 2);
+
+                THEN("only the results of the range are written")
+                {
+                    const auto expected =
+                        transform(sampleMatrices[1], sampleVectors[1]);
+                    REQUIRE(results.at(1, 0) == expected.at(0));
+                    REQUIRE(results.at(0, 0) == 0.0F);
+                    REQUIRE(results.at(2, 0) == 0.0F);
+                }
+            }
+        }
+    }
+}
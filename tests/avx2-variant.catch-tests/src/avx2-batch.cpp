@@ -0,0 +1,63 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 batch transformation")
+    {
+        GIVEN("a matrix spanning several row tiles and a batch of vectors")
+        {
+            const auto matrix = integralMatrix(137, 21);
+
+            std::vector<AVXVector> sampleVectors;
+            for (size_t b{0}; b < 5; ++b)
+            {
+                AVXVector v(21);
+                for (size_t i{0}; i < v.size(); ++i)
+                {
+                    v.at(i) = static_cast<float>((i + b) % 3) - 1.0F;
+                }
+                sampleVectors.push_back(v);
+            }
+
+            std::vector<const AVXVector *> inputVectors;
+            for (auto && sampleVector : sampleVectors)
+            {
+                inputVectors.push_back(&sampleVector);
+            }
+
+            WHEN("transforming the batch by the matrix")
+            {
+                const auto results = transformBatch(matrix, inputVectors);
+
+                THEN("each result equals the single transformation")
+                {
+                    REQUIRE(results.size() == sampleVectors.size());
+                    for (size_t b{0}; b < results.size(); ++b)
+                    {
+                        const auto singleResult =
+                            transform(matrix, sampleVectors[b]);
+                        REQUIRE_THAT(results[b].packs(),
+                                     Equals(singleResult.packs()));
+                    }
+                }
+            }
+        }
+
+        GIVEN("an empty batch")
+        {
+            const auto matrix = integralMatrix(3, 3);
+
+            WHEN("transforming it")
+            {
+                const auto results = transformBatch(matrix, {});
+
+                THEN("there are no results")
+                {
+                    REQUIRE(results.empty());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        AVXVector rampVector(const size_t size, const float offset)
+        {
+            AVXVector v(size);
+            for (size_t i{0}; i < size; ++i)
+            {
+                v.at(i) = static_cast<float>(i % 7) - offset;
+            }
+            return v;
+        }
+
+        bool hasPadding(const AVXVector & v)
+        {
+            for (auto i = v.size(); i < v.packs().size() * 8; ++i)
+            {
+                const auto element = v.packs()[i / 8][i % 8];
+                if (element != 0.0F || !std::signbit(element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    SCENARIO("AVX2 level-1 vector operations")
+    {
+        GIVEN("two vectors over several reduction blocks with a padded tail")
+        {
+            // Small integral values keep all sums exact in any order.
+            constexpr size_t size{REDUCTION_BLOCK_PACKS * 8 * 2 + 13};
+            const auto x = rampVector(size, 3.0F);
+            auto y = rampVector(size, 1.0F);
+
+            float expectedDot{0.0F};
+            float expectedSquaredNorm{0.0F};
+            for (size_t i{0}; i < size; ++i)
+            {
+                expectedDot += x.at(i) * y.at(i);
+                expectedSquaredNorm += y.at(i) * y.at(i);
+            }
+
+            WHEN("reducing them")
+            {
+                THEN("the dot product and norms are exact")
+                {
+                    REQUIRE(reductionBlocks(x) == 3);
+                    REQUIRE(dot(x, y) == expectedDot);
+                    REQUIRE(squaredNorm(y) == expectedSquaredNorm);
+                    REQUIRE(norm(y) == std::sqrt(expectedSquaredNorm));
+
+                    const auto [fusedDot, fusedSquaredNorm] =
+                        dotAndSquaredNorm(x, y);
+                    REQUIRE(fusedDot == expectedDot);
+                    REQUIRE(fusedSquaredNorm == expectedSquaredNorm);
+                }
+            }
+
+            WHEN("reducing the blocks into partial sums")
+            {
+                std::vector<AVXPack> partials(reductionBlocks(x));
+                dot(x, y, 0, 1, partials.data());
+                dot(x, y, 1, partials.size(), partials.data());
+
+                THEN("their sum equals the dot product")
+                {
+                    REQUIRE(sumPartials(partials.data(), partials.size()) ==
+                            dot(x, y));
+                }
+            }
+
+            WHEN("updating y by a negative multiple of x")
+            {
+                auto expected = y;
+                for (size_t i{0}; i < size; ++i)
+                {
+                    expected.at(i) = -2.0F * x.at(i) + 0.5F * y.at(i);
+                }
+
+                const auto squaredNormOfUpdate =
+                    axpbyAndSquaredNorm(-2.0F, x, 0.5F, y);
+
+                THEN("each element is updated and the padding is kept")
+                {
+                    REQUIRE_THAT(y.packs(), Equals(expected.packs()));
+                    REQUIRE(hasPadding(y));
+                    REQUIRE(squaredNormOfUpdate == squaredNorm(expected));
+                }
+            }
+
+            WHEN("applying the element-wise operations")
+            {
+                auto scaled = x;
+                scale(-1.0F, scaled);
+                auto updated = y;
+                axpy(3.0F, x, updated);
+                AVXVector sum(size);
+                add(x, y, sum);
+                AVXVector product(size);
+                multiplyElementwise(x, y, product);
+
+                THEN("each element is computed and the padding is kept")
+                {
+                    for (size_t i{0}; i < size; ++i)
+                    {
+                        REQUIRE(scaled.at(i) == -x.at(i));
+                        REQUIRE(updated.at(i) == y.at(i) + 3.0F * x.at(i));
+                        REQUIRE(sum.at(i) == x.at(i) + y.at(i));
+                        REQUIRE(product.at(i) == x.at(i) * y.at(i));
+                    }
+                    REQUIRE(hasPadding(scaled));
+                    REQUIRE(hasPadding(updated));
+                    REQUIRE(hasPadding(sum));
+                    REQUIRE(hasPadding(product));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    AVXVector addBiasAndRelu(const AVXVector & vector, const AVXVector & bias)
+    {
+        AVXVector v(vector.size());
+        for (size_t i{0}; i < vector.size(); ++i)
+        {
+            v.at(i) = std::max(vector.at(i) + bias.at(i), 0.0F);
+        }
+        return v;
+    }
+
+    SCENARIO("AVX2 transformation chain")
+    {
+        GIVEN("a single layer chain")
+        {
+            const auto matrix = integralMatrix(9, 10);
+            const auto sampleVector = integralVector(10);
+
+            TransformChain chain{{ChainLayer{&matrix}}};
+
+            WHEN("transforming the vector by the chain")
+            {
+                const auto & result = chain(sampleVector);
+
+                THEN("it equals the plain transformation")
+                {
+                    REQUIRE(result.size() == 9);
+                    const auto plainResult = transform(matrix, sampleVector);
+                    REQUIRE_THAT(result.packs(), Equals(plainResult.packs()));
+                }
+            }
+        }
+
+        GIVEN("three layers of different widths with bias and ReLU")
+        {
+            const auto first = integralMatrix(17, 10);
+            const auto second = integralMatrix(9, 17);
+            const auto third = integralMatrix(20, 9);
+            const auto firstBias = integralVector(17);
+            const auto thirdBias = integralVector(20);
+            const auto sampleVector = integralVector(10);
+
+            const std::vector<ChainLayer> layers{
+                ChainLayer{&first, relu(&firstBias)},
+                ChainLayer{&second},
+                ChainLayer{&third, relu(&thirdBias)},
+            };
+
+            const auto firstResult =
+                addBiasAndRelu(transform(first, sampleVector), firstBias);
+            const auto expectedVector = addBiasAndRelu(
+                transform(third, transform(second, firstResult)), thirdBias);
+
+            WHEN("transforming the vector with fused layers")
+            {
+                TransformChain chain{layers, SIZE_MAX};
+                const auto & result = chain(sampleVector);
+
+                THEN("it equals the step-wise transformation")
+                {
+                    REQUIRE(result.size() == 20);
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(expectedVector.packs()));
+                }
+            }
+
+            WHEN("transforming the vector with separate layers")
+            {
+                TransformChain chain{layers, 0};
+                const auto & result = chain(sampleVector);
+
+                THEN("it equals the step-wise transformation")
+                {
+                    REQUIRE(result.size() == 20);
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(expectedVector.packs()));
+                }
+            }
+
+            WHEN("transforming the vector twice")
+            {
+                TransformChain chain{layers};
+                chain(sampleVector);
+                const auto & result = chain(sampleVector);
+
+                THEN("the reused buffers yield the same result")
+                {
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(expectedVector.packs()));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 transformation with epilogue")
+    {
+        GIVEN("a 10D vector, a 9x10 matrix of ones and a bias")
+        {
+            const auto sampleVector = []() {
+                AVXVector v(10);
+                for (size_t i{0}; i < 10; ++i)
+                {
+                    v.at(i) = static_cast<float>(i) - 4.0F;
+                }
+                return v;
+            }();
+
+            const SOAMatrix matrix{9, 10, 1.0F};
+
+            const auto bias = []() {
+                AVXVector v(9);
+                for (size_t i{0}; i < 9; ++i)
+                {
+                    v.at(i) = static_cast<float>(i);
+                }
+                return v;
+            }();
+
+            WHEN("transforming with the default epilogue")
+            {
+                const auto result = transform(
+                    matrix, sampleVector, TransformOptions{Epilogue{}});
+
+                THEN("the result equals the plain transformation")
+                {
+                    const auto plainResult = transform(matrix, sampleVector);
+                    REQUIRE_THAT(result.packs(), Equals(plainResult.packs()));
+                }
+            }
+
+            WHEN("transforming with negation, bias and ReLU")
+            {
+                const TransformOptions options{Epilogue{-1.0F, &bias, 0.0F}};
+                const auto result = transform(matrix, sampleVector, options);
+
+                THEN("each element is max(bias - 5, 0)")
+                {
+                    REQUIRE(result.at(0) == 0.0F);
+                    REQUIRE(result.at(4) == 0.0F);
+                    REQUIRE(result.at(5) == 0.0F);
+                    REQUIRE(result.at(6) == 1.0F);
+                    REQUIRE(result.at(8) == 3.0F);
+                }
+            }
+
+            WHEN("transforming with negation, bias and bounds")
+            {
+                const TransformOptions options{
+                    Epilogue{-1.0F, &bias, -3.0F, 1.0F}};
+                const auto result = transform(matrix, sampleVector, options);
+
+                THEN("each element is clamped into the bounds")
+                {
+                    REQUIRE(result.at(0) == -3.0F);
+                    REQUIRE(result.at(2) == -3.0F);
+                    REQUIRE(result.at(5) == 0.0F);
+                    REQUIRE(result.at(6) == 1.0F);
+                    REQUIRE(result.at(8) == 1.0F);
+                }
+
+                THEN("the padding is kept")
+                {
+                    REQUIRE(result.packs()[1][1] == PADDING_VALUE);
+                    REQUIRE(std::signbit(result.packs()[1][7]));
+                }
+            }
+
+            WHEN("transforming with streaming and with cached stores")
+            {
+                const auto cached = transform(
+                    matrix, sampleVector,
+                    TransformOptions{relu(&bias), StoreMode::CACHED});
+                const auto streamed = transform(
+                    matrix, sampleVector,
+                    TransformOptions{relu(&bias), StoreMode::STREAMING});
+
+                THEN("both results are equal")
+                {
+                    REQUIRE_THAT(streamed.packs(), Equals(cached.packs()));
+                }
+            }
+
+            WHEN("transforming with and without prefetching")
+            {
+                const auto plain = transform(matrix, sampleVector);
+                const auto prefetched = transform(
+                    matrix, sampleVector,
+                    TransformOptions{Epilogue{}, StoreMode::AUTOMATIC, 3});
+
+                THEN("both results are equal")
+                {
+                    REQUIRE_THAT(prefetched.packs(), Equals(plain.packs()));
+                }
+            }
+        }
+    }
+}
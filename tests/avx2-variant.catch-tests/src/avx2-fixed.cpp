@@ -0,0 +1,91 @@
+#include "test_commons.h"
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        template <size_t R, size_t C>
+        void requireFixedEqualsDynamic()
+        {
+            const auto matrix = integralMatrix(R, C);
+            const auto inputVector = integralVector(C);
+
+            FixedMatrix<R, C> fixedMatrix;
+            for (size_t c{0}; c < C; ++c)
+            {
+                for (size_t r{0}; r < R; ++r)
+                {
+                    fixedMatrix.at(r, c) = matrix.at(r, c);
+                }
+            }
+            FixedVector<C> fixedInputVector;
+            for (size_t i{0}; i < C; ++i)
+            {
+                fixedInputVector.at(i) = inputVector.at(i);
+            }
+
+            const auto result = transform(fixedMatrix, fixedInputVector);
+            const auto expected = transform(matrix, inputVector);
+
+            for (size_t i{0}; i < R; ++i)
+            {
+                REQUIRE(result.at(i) == expected.at(i));
+            }
+            for (auto i = R; i < FixedVector<R>::PACKS * 8; ++i)
+            {
+                REQUIRE(std::signbit(result.at(i)));
+                REQUIRE(result.at(i) == 0.0F);
+            }
+        }
+    }
+
+    SCENARIO("AVX2 fixed-size transformation")
+    {
+        GIVEN("fixed-size matrices and vectors of the supported sizes")
+        {
+            WHEN("transforming them")
+            {
+                THEN("the results equal the dynamic transformation")
+                {
+                    requireFixedEqualsDynamic<4, 4>();
+                    requireFixedEqualsDynamic<8, 8>();
+                    requireFixedEqualsDynamic<16, 16>();
+                    requireFixedEqualsDynamic<32, 32>();
+                }
+            }
+        }
+
+        GIVEN("fixed-size matrices of uneven shapes")
+        {
+            WHEN("transforming them")
+            {
+                THEN("the results equal the dynamic transformation and keep "
+                     "the padding")
+                {
+                    requireFixedEqualsDynamic<1, 1>();
+                    requireFixedEqualsDynamic<5, 12>();
+                    requireFixedEqualsDynamic<19, 3>();
+                }
+            }
+        }
+
+        GIVEN("a default constructed fixed-size vector")
+        {
+            const FixedVector<5> v;
+
+            THEN("the elements are zero and the padding is negative zero")
+            {
+                REQUIRE(v.size() == 5);
+                for (size_t i{0}; i < 5; ++i)
+                {
+                    REQUIRE(v.at(i) == 0.0F);
+                    REQUIRE_FALSE(std::signbit(v.at(i)));
+                }
+                for (size_t i{5}; i < 8; ++i)
+                {
+                    REQUIRE(std::signbit(v.at(i)));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    namespace
+    {
+        scalar::ScalarMatrix toScalarMatrix(const SOAMatrix & matrix)
+        {
+            scalar::ScalarMatrix scalarMatrix{matrix.rows(), matrix.columns()};
+            for (size_t c{0}; c < matrix.columns(); ++c)
+            {
+                for (size_t r{0}; r < matrix.rows(); ++r)
+                {
+                    scalarMatrix.at(r, c) = matrix.at(r, c);
+                }
+            }
+            return scalarMatrix;
+        }
+
+        void requireEqualsScalarReference(const size_t rows,
+                                          const size_t inner,
+                                          const size_t columns)
+        {
+            const auto a = integralMatrix(rows, inner);
+            const auto b = integralMatrix(inner, columns);
+
+            const auto result = multiply(a, b);
+            const auto expected =
+                scalar::multiply(toScalarMatrix(a), toScalarMatrix(b));
+
+            REQUIRE(result.rows() == rows);
+            REQUIRE(result.columns() == columns);
+            for (size_t c{0}; c < columns; ++c)
+            {
+                for (size_t r{0}; r < rows; ++r)
+                {
+                    REQUIRE(result.at(r, c) == expected.at(r, c));
+                }
+                for (auto r = rows; r < padSize(rows) * 8; ++r)
+                {
+                    REQUIRE(std::signbit(result.at(r, c)));
+                }
+            }
+        }
+    }
+
+    SCENARIO("AVX2 matrix-matrix multiplication")
+    {
+        GIVEN("matrices of shapes within one tile")
+        {
+            THEN("the products equal the scalar reference")
+            {
+                requireEqualsScalarReference(1, 1, 1);
+                requireEqualsScalarReference(16, 3, 6);
+                requireEqualsScalarReference(5, 9, 2);
+            }
+        }
+
+        GIVEN("matrices of shapes spanning several tiles and cache blocks")
+        {
+            THEN("the products equal the scalar reference")
+            {
+                // Partial tiles in both dimensions, more than one block of
+                // the inner dimension and of the rows.
+                requireEqualsScalarReference(137, 300, 13);
+
+                // More than one block of the columns.
+                requireEqualsScalarReference(20, 7, 1543);
+            }
+        }
+
+        GIVEN("a product computed in column ranges")
+        {
+            const auto a = integralMatrix(29, 40);
+            const auto b = integralMatrix(40, 25);
+            const auto expected = multiply(a, b);
+
+            WHEN("computing the ranges one after another into one result")
+            {
+                SOAMatrix result{29, 25, 7.0F};
+                multiply(a, b, result, 0, 12);
+                multiply(a, b, result, 12, 13);
+                multiply(a, b, result, 13, 25);
+
+                THEN("it equals the product computed at once")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+    }
+}
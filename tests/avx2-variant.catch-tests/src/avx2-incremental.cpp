@@ -0,0 +1,86 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 incremental transformation")
+    {
+        GIVEN("an incremental transformation of an integral vector")
+        {
+            const auto matrix = integralMatrix(19, 40);
+            auto sampleVector = integralVector(40);
+
+            IncrementalOptions options{};
+            options.refreshInterval = 3;
+            IncrementalTransform incrementalTransform{matrix, sampleVector,
+                                                      options};
+
+            THEN("it starts with the plain transformation")
+            {
+                const auto expected = transform(matrix, sampleVector);
+                REQUIRE_THAT(incrementalTransform.result().packs(),
+                             Equals(expected.packs()));
+            }
+
+            WHEN("changing a few elements")
+            {
+                const std::vector<InputChange> changes{
+                    {3, 2.0F}, {17, -1.0F}, {39, 3.0F}, {3, 1.0F}};
+                const auto & result = incrementalTransform.update(changes);
+
+                sampleVector.at(3) = 1.0F;
+                sampleVector.at(17) = -1.0F;
+                sampleVector.at(39) = 3.0F;
+
+                THEN("the result equals the transformation of the new input")
+                {
+                    const auto expected = transform(matrix, sampleVector);
+                    REQUIRE_THAT(incrementalTransform.input().packs(),
+                                 Equals(sampleVector.packs()));
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+
+                THEN("it only passed the changed columns")
+                {
+                    REQUIRE(incrementalTransform.stats().incrementalUpdates ==
+                            1);
+                    REQUIRE(incrementalTransform.stats().fullRecomputes == 0);
+                }
+            }
+
+            WHEN("changing most of the elements")
+            {
+                std::vector<InputChange> changes;
+                for (size_t i{0}; i < 30; ++i)
+                {
+                    changes.push_back({i, 1.0F});
+                    sampleVector.at(i) = 1.0F;
+                }
+                const auto & result = incrementalTransform.update(changes);
+
+                THEN("it falls back to a full recomputation")
+                {
+                    const auto expected = transform(matrix, sampleVector);
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                    REQUIRE(incrementalTransform.stats().fullRecomputes == 1);
+                }
+            }
+
+            WHEN("updating as often as the refresh interval")
+            {
+                for (auto i = 0; i < 3; ++i)
+                {
+                    incrementalTransform.update({{5, static_cast<float>(i)}});
+                }
+
+                THEN("the last update is a full refresh")
+                {
+                    REQUIRE(incrementalTransform.stats().incrementalUpdates ==
+                            2);
+                    REQUIRE(incrementalTransform.stats().fullRecomputes == 1);
+                }
+            }
+        }
+    }
+}
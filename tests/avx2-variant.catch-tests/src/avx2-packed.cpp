@@ -0,0 +1,45 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 transformation by packed matrices")
+    {
+        GIVEN("a matrix with partial row and column panels and a vector")
+        {
+            const auto matrix = integralMatrix(77, 45);
+            const auto inputVector = integralVector(45);
+            const auto expected = transform(matrix, inputVector);
+
+            WHEN("transforming by the matrix packed with several blockings")
+            {
+                THEN("each result equals the unpacked transformation")
+                {
+                    for (auto blocking : {PackedBlocking{},
+                                          PackedBlocking{1, 8},
+                                          PackedBlocking{3, 16},
+                                          PackedBlocking{8, 40}})
+                    {
+                        const PackedMatrix packed{matrix, blocking};
+                        REQUIRE_THAT(transformPacked(packed, inputVector)
+                                         .packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("transforming into a reused result vector")
+            {
+                const PackedMatrix packed{matrix, PackedBlocking{4, 16}};
+                AVXVector result(77, 5.0F);
+                transformPacked(packed, inputVector, result);
+
+                THEN("the previous content is overwritten")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+    }
+}
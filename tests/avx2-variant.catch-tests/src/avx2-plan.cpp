@@ -0,0 +1,110 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 transformation by plans")
+    {
+        GIVEN("matrices of small and large shapes and vectors")
+        {
+            const std::pair<size_t, size_t> shapes[]{
+                {1, 1}, {5, 9}, {64, 33}, {65, 17}, {200, 3}};
+
+            WHEN("executing plans with each kernel and count of threads")
+            {
+                THEN("each result equals the transformation")
+                {
+                    for (const auto & [rows, columns] : shapes)
+                    {
+                        const auto matrix = integralMatrix(rows, columns);
+                        const auto inputVector = integralVector(columns);
+                        const auto expected = transform(matrix, inputVector);
+
+                        for (const auto kernel : {PlanKernel::AUTOMATIC,
+                                                  PlanKernel::COLUMN_PASSES,
+                                                  PlanKernel::REGISTER_BLOCKED})
+                        {
+                            for (const size_t threads : {1, 3})
+                            {
+                                PlanOptions options{};
+                                options.kernel = kernel;
+                                options.threads = threads;
+                                const TransformPlan plan{rows, columns,
+                                                         options};
+
+                                AVXVector result(rows, 5.0F);
+                                plan.execute(matrix, inputVector, result);
+                                REQUIRE_THAT(result.packs(),
+                                             Equals(expected.packs()));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        GIVEN("a matrix, a vector and a bias")
+        {
+            const auto matrix = integralMatrix(77, 45);
+            const auto inputVector = integralVector(45);
+            const auto bias = integralVector(77);
+            TransformOptions transformOptions{Epilogue{-1.0F, &bias, 0.0F}};
+            transformOptions.prefetchDistance = 16;
+            const auto expected =
+                transform(matrix, inputVector, transformOptions);
+
+            WHEN("executing plans with the epilogue and prefetching")
+            {
+                THEN("each result equals the transformation with them")
+                {
+                    for (const auto kernel : {PlanKernel::COLUMN_PASSES,
+                                              PlanKernel::REGISTER_BLOCKED})
+                    {
+                        PlanOptions options{transformOptions, kernel};
+                        const TransformPlan plan{77, 45, options};
+
+                        AVXVector result(77);
+                        plan.execute(matrix, inputVector, result);
+                        REQUIRE_THAT(result.packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+
+            WHEN("executing the parts of the threads one by one")
+            {
+                PlanOptions options{transformOptions};
+                options.threads = 4;
+                const TransformPlan plan{77, 45, options};
+
+                AVXVector result(77, 5.0F);
+                for (size_t thread{0}; thread < plan.threads(); ++thread)
+                {
+                    plan.execute(matrix, inputVector, result, thread);
+                }
+                plan.finish(result);
+
+                THEN("the result equals the one of a single execution")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+
+        GIVEN("plans with the automatic kernel")
+        {
+            const TransformPlan small{64, 100};
+            const TransformPlan large{65, 100};
+
+            THEN("small shapes are register-blocked like transform does")
+            {
+                REQUIRE(small.kernel() == PlanKernel::REGISTER_BLOCKED);
+                REQUIRE(large.kernel() == PlanKernel::COLUMN_PASSES);
+                REQUIRE(small.rows() == 64);
+                REQUIRE(small.columns() == 100);
+                REQUIRE(small.threads() == 1);
+            }
+        }
+    }
+}
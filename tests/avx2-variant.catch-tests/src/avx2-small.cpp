@@ -0,0 +1,84 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 small-shape transformation")
+    {
+        GIVEN("small matrices of each supported count of row packs")
+        {
+            WHEN("transforming a vector by them")
+            {
+                THEN("the results equal the general transformation bit by "
+                     "bit")
+                {
+                    for (size_t rows{1}; rows <= SMALL_KERNEL_MAX_ROWS; ++rows)
+                    {
+                        const auto columns = rows % 13 + 1;
+                        SOAMatrix matrix{rows, columns};
+                        for (size_t c{0}; c < columns; ++c)
+                        {
+                            for (size_t r{0}; r < rows; ++r)
+                            {
+                                matrix.at(r, c) =
+                                    1.0F / static_cast<float>(r + c + 3);
+                            }
+                        }
+                        AVXVector inputVector(columns);
+                        for (size_t i{0}; i < columns; ++i)
+                        {
+                            inputVector.at(i) =
+                                static_cast<float>(i) * 0.7F - 1.3F;
+                        }
+
+                        REQUIRE(isSmallShape(matrix));
+
+                        AVXVector result(rows);
+                        transformSmall(matrix, inputVector, result);
+                        const auto expected =
+                            transform(matrix, inputVector, TransformOptions{});
+                        REQUIRE_THAT(result.packs(),
+                                     Equals(expected.packs()));
+                        REQUIRE_THAT(transform(matrix, inputVector).packs(),
+                                     Equals(expected.packs()));
+                    }
+                }
+            }
+        }
+
+        GIVEN("a result vector reused for several transformations")
+        {
+            const auto matrix = integralMatrix(13, 9);
+            AVXVector result(13);
+
+            WHEN("transforming different vectors into it")
+            {
+                auto inputVector = integralVector(9);
+                transformSmall(matrix, inputVector, result);
+                inputVector.at(4) = 3.0F;
+                transformSmall(matrix, inputVector, result);
+
+                THEN("it holds the last result and keeps the padding")
+                {
+                    const auto expected = transform(matrix, inputVector);
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                    for (size_t i{13}; i < 16; ++i)
+                    {
+                        REQUIRE(std::signbit(result.at(i)));
+                    }
+                }
+            }
+        }
+
+        GIVEN("a matrix above the small row limit")
+        {
+            const SOAMatrix matrix{SMALL_KERNEL_MAX_ROWS + 1, 2};
+
+            THEN("it is not a small shape")
+            {
+                REQUIRE_FALSE(isSmallShape(matrix));
+            }
+        }
+    }
+}
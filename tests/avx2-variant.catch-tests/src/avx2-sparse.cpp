@@ -0,0 +1,115 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::avx2
+{
+    SCENARIO("AVX2 sparse-input transformation")
+    {
+        GIVEN("a matrix and a mostly zero input vector")
+        {
+            const auto matrix = integralMatrix(21, 35);
+
+            AVXVector inputVector(35);
+            inputVector.at(0) = 2.0F;
+            inputVector.at(9) = -1.0F;
+            inputVector.at(17) = 3.0F;
+            inputVector.at(34) = 1.0F;
+
+            const auto expected = transform(matrix, inputVector);
+
+            WHEN("transforming the dense vector sparsely")
+            {
+                const auto result = transformSparse(matrix, inputVector);
+
+                THEN("the result equals the dense transformation")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                    for (size_t i{21}; i < 24; ++i)
+                    {
+                        REQUIRE(std::signbit(result.at(i)));
+                    }
+                }
+            }
+
+            WHEN("collecting its non-zero elements")
+            {
+                const auto elements = nonZeroElements(inputVector);
+
+                THEN("they are the set elements in order of their indices")
+                {
+                    REQUIRE(elements.size() == 4);
+                    REQUIRE(elements[0].index == 0);
+                    REQUIRE(elements[1].index == 9);
+                    REQUIRE(elements[2].index == 17);
+                    REQUIRE(elements[3].index == 34);
+                    REQUIRE(elements[3].value == 1.0F);
+                }
+            }
+
+            WHEN("transforming the elements in any order")
+            {
+                const std::vector<SparseElement> elements{
+                    {34, 1.0F}, {9, -1.0F}, {0, 2.0F}, {17, 3.0F}};
+                const auto result = transformSparse(matrix, elements);
+
+                THEN("the result equals the dense transformation")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+
+            WHEN("transforming elements of the same index")
+            {
+                const std::vector<SparseElement> elements{
+                    {0, 1.0F}, {9, -1.0F}, {0, 1.0F}, {17, 3.0F}, {34, 1.0F}};
+                const auto result = transformSparse(matrix, elements);
+
+                THEN("their values add up")
+                {
+                    REQUIRE_THAT(result.packs(), Equals(expected.packs()));
+                }
+            }
+        }
+
+        GIVEN("an input vector of only zeros")
+        {
+            const auto matrix = integralMatrix(5, 9);
+            const AVXVector inputVector(9);
+
+            WHEN("transforming it sparsely")
+            {
+                const auto result = transformSparse(matrix, inputVector);
+
+                THEN("the result is zero and keeps the padding")
+                {
+                    for (size_t i{0}; i < 5; ++i)
+                    {
+                        REQUIRE(result.at(i) == 0.0F);
+                    }
+                    for (size_t i{5}; i < 8; ++i)
+                    {
+                        REQUIRE(std::signbit(result.at(i)));
+                    }
+                }
+            }
+        }
+
+        GIVEN("an input vector with a NaN element")
+        {
+            const auto matrix = integralMatrix(3, 4);
+            AVXVector inputVector(4);
+            inputVector.at(2) = std::numeric_limits<float>::quiet_NaN();
+
+            WHEN("transforming it sparsely")
+            {
+                const auto result = transformSparse(matrix, inputVector);
+
+                THEN("the NaN propagates into the result")
+                {
+                    REQUIRE(std::isnan(result.at(0)));
+                }
+            }
+        }
+    }
+}
@@ -132,6 +132,19 @@ namespace matrixmultiplication::avx2
                                  Equals(expectedVector.packs()));
                 }
             }
+
+            WHEN("transforming the vector into a reused result vector")
+            {
+                AVXVector result(9, 5.0F);
+                transform(identityMatrix, sampleVector, result);
+
+                THEN("the previous content is overwritten")
+                {
+                    REQUIRE_THAT(result.packs(),
+                                 Equals(transform(identityMatrix, sampleVector)
+                                            .packs()));
+                }
+            }
         }
     }
 } // namespace matrixmultiplication::scalar
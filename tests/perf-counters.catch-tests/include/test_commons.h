@@ -0,0 +1,8 @@
+#pragma once
+
+#include <profiled-transforms.h>
+
+#include <avx2-variant-mt.h>
+#include <avx2-variant.h>
+
+#include <catch2/catch.hpp>
@@ -0,0 +1,75 @@
+#include "test_commons.h"
+
+using Catch::Matchers::Equals;
+
+namespace matrixmultiplication::profiling
+{
+    SCENARIO("profiled transformations")
+    {
+        GIVEN("a 10D vector and a 9x10 matrix")
+        {
+            const avx2::AVXVector sampleVector(10, 2.0F);
+            const avx2::SOAMatrix matrix{9, 10, 1.0F};
+
+            WHEN("transforming the vector with profiling")
+            {
+                PerfStats stats;
+                const auto result = transform(matrix, sampleVector, stats);
+
+                THEN("the result equals the plain transformation")
+                {
+                    const auto plainResult =
+                        avx2::transform(matrix, sampleVector);
+                    REQUIRE_THAT(result.packs(), Equals(plainResult.packs()));
+                }
+
+                THEN("the bytes of matrix and vectors are reported")
+                {
+                    REQUIRE(stats.bytesMoved == (20 + 2 + 2) * 32.0);
+                }
+
+                THEN("the counters are either unavailable or have counted")
+                {
+                    REQUIRE((!stats.available || stats.instructions > 0));
+                }
+            }
+
+            WHEN("transforming the vector multi-threaded with profiling")
+            {
+                PerfStats stats;
+                const auto result =
+                    transformMultiThreaded(matrix, sampleVector, stats);
+
+                THEN("the result equals the plain transformation")
+                {
+                    const auto plainResult =
+                        avx2::transformMultiThreaded(matrix, sampleVector);
+                    REQUIRE_THAT(result.packs(), Equals(plainResult.packs()));
+                }
+            }
+        }
+
+        GIVEN("a scalar 2D vector and a 3x2 matrix")
+        {
+            const scalar::ScalarVector sampleVector{1.0F, 2.0F};
+            const scalar::ScalarMatrix matrix{3, 2, 1.0F};
+
+            WHEN("transforming the vector with profiling")
+            {
+                PerfStats stats;
+                const auto result = transform(matrix, sampleVector, stats);
+
+                THEN("the result equals the plain transformation")
+                {
+                    REQUIRE_THAT(result, Equals(scalar::ScalarVector{
+                                             3.0F, 3.0F, 3.0F}));
+                }
+
+                THEN("the bytes of matrix and vectors are reported")
+                {
+                    REQUIRE(stats.bytesMoved == (6 + 2 + 3) * 4.0);
+                }
+            }
+        }
+    }
+}
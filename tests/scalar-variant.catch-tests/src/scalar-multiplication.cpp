@@ -0,0 +1,66 @@
+#include "test_commons.h"
+
+namespace matrixmultiplication::scalar
+{
+    SCENARIO("scalar matrix multiplication")
+    {
+        GIVEN("a 2x3 and a 3x2 matrix")
+        {
+            ScalarMatrix a{2, 3};
+            ScalarMatrix b{3, 2};
+            for (size_t r{0}; r < 2; ++r)
+            {
+                for (size_t c{0}; c < 3; ++c)
+                {
+                    a.at(r, c) = static_cast<float>(r * 3 + c + 1);
+                    b.at(c, r) = static_cast<float>(r * 3 + c + 1);
+                }
+            }
+
+            WHEN("multiplying them")
+            {
+                const auto result = multiply(a, b);
+
+                THEN("it results in a 2x2 matrix of the dot products")
+                {
+                    REQUIRE(result.rows() == 2);
+                    REQUIRE(result.columns() == 2);
+                    REQUIRE(result.at(0, 0) == 14.0F);
+                    REQUIRE(result.at(0, 1) == 32.0F);
+                    REQUIRE(result.at(1, 0) == 32.0F);
+                    REQUIRE(result.at(1, 1) == 77.0F);
+                }
+            }
+        }
+
+        GIVEN("a matrix and the identity matrix")
+        {
+            ScalarMatrix a{3, 4};
+            ScalarMatrix identity{4, 4};
+            for (size_t c{0}; c < 4; ++c)
+            {
+                identity.at(c, c) = 1.0F;
+                for (size_t r{0}; r < 3; ++r)
+                {
+                    a.at(r, c) = static_cast<float>(r) - static_cast<float>(c);
+                }
+            }
+
+            WHEN("multiplying them")
+            {
+                const auto result = multiply(a, identity);
+
+                THEN("the result equals the matrix")
+                {
+                    for (size_t r{0}; r < 3; ++r)
+                    {
+                        for (size_t c{0}; c < 4; ++c)
+                        {
+                            REQUIRE(result.at(r, c) == a.at(r, c));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <avx2-model.h>
+
+#include <cstddef>
+
+// Fixtures shared by the test projects of the AVX2 variants.
+namespace matrixmultiplication::avx2
+{
+    // Small integral values keep all sums exact in any order, so that the
+    // results do not depend on the order of the additions or on whether the
+    // compiler contracts multiply and add into FMA.
+    inline SOAMatrix integralMatrix(const std::size_t rows,
+                                    const std::size_t columns)
+    {
+        SOAMatrix m{rows, columns};
+        for (std::size_t c{0}; c < columns; ++c)
+        {
+            for (std::size_t r{0}; r < rows; ++r)
+            {
+                m.at(r, c) = static_cast<float>((r + 2 * c) % 5) - 2.0F;
+            }
+        }
+        return m;
+    }
+
+    inline AVXVector integralVector(const std::size_t size)
+    {
+        AVXVector v(size);
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            v.at(i) = static_cast<float>(i % 3) - 1.0F;
+        }
+        return v;
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <tracing.h>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace matrixmultiplication::tracing
+{
+    inline bool containsPhase(const std::vector<Event> & events,
+                              const Phase phase)
+    {
+        return std::any_of(
+            events.cbegin(), events.cend(),
+            [phase](const Event & event) { return event.phase == phase; });
+    }
+}
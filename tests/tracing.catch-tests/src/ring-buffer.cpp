@@ -0,0 +1,97 @@
+#include "test_commons.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using Catch::Matchers::Contains;
+using Catch::Matchers::StartsWith;
+
+namespace matrixmultiplication::tracing
+{
+    SCENARIO("Tracing into per-thread ring buffers")
+    {
+        GIVEN("cleared events")
+        {
+            clear();
+
+            WHEN("recording phases on this and another thread")
+            {
+                const auto begin = ticks();
+                record(Phase::COMPUTE, begin, begin + 10);
+                std::thread other{[begin]() {
+                    record(Phase::MERGE, begin + 5, begin + 20);
+                }};
+                other.join();
+                record(Phase::EPILOGUE, begin + 30, begin + 40);
+                const auto events = collect();
+
+                THEN("the events of both threads are ordered by begin")
+                {
+                    REQUIRE(events.size() == 3);
+                    REQUIRE(events[0].phase == Phase::COMPUTE);
+                    REQUIRE(events[1].phase == Phase::MERGE);
+                    REQUIRE(events[2].phase == Phase::EPILOGUE);
+                    REQUIRE(events[0].thread == events[2].thread);
+                    REQUIRE(events[0].thread != events[1].thread);
+                    REQUIRE(events[1].endTicks == begin + 20);
+                }
+            }
+
+            WHEN("recording more events than a ring buffer holds")
+            {
+                const auto begin = ticks();
+                for (size_t i{0}; i < RING_CAPACITY + 10; ++i)
+                {
+                    record(Phase::COMPUTE, begin + i, begin + i + 1);
+                }
+                const auto events = collect();
+
+                THEN("the newest events are kept")
+                {
+                    REQUIRE(events.size() == RING_CAPACITY);
+                    REQUIRE(events.front().beginTicks == begin + 10);
+                    REQUIRE(events.back().beginTicks ==
+                            begin + RING_CAPACITY + 9);
+                }
+            }
+
+            WHEN("clearing after recording")
+            {
+                const auto begin = ticks();
+                record(Phase::COMPUTE, begin, begin + 1);
+                clear();
+
+                THEN("no events are collected")
+                {
+                    REQUIRE(collect().empty());
+                }
+            }
+        }
+
+        GIVEN("recorded events")
+        {
+            clear();
+            const auto begin = ticks();
+            record(Phase::CALL, begin, begin + 3000);
+            record(Phase::ALLOCATION, begin + 100, begin + 200);
+
+            WHEN("writing them as Chrome trace")
+            {
+                std::ostringstream stream;
+                writeChromeTrace(collect(), stream);
+                const auto trace = stream.str();
+
+                THEN("each event is a complete event with its phase")
+                {
+                    REQUIRE_THAT(trace, StartsWith("{\"displayTimeUnit\""));
+                    REQUIRE_THAT(trace, Contains("\"name\":\"call\""));
+                    REQUIRE_THAT(trace, Contains("\"name\":\"allocation\""));
+                    REQUIRE_THAT(trace, Contains("\"ts\":0.000,"));
+                    REQUIRE(std::count(trace.cbegin(), trace.cend(), '{') ==
+                            3);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#include "test_commons.h"
+
+#include <avx2-variant-mt.h>
+
+namespace matrixmultiplication::tracing
+{
+    SCENARIO("Tracing the phases of the transformations")
+    {
+        GIVEN("a wide matrix and a vector")
+        {
+            const avx2::SOAMatrix matrix{13, 2000};
+            const avx2::AVXVector inputVector(2000, 1.0F);
+            clear();
+
+            WHEN("splitting the columns with tracing enabled")
+            {
+                setEnabled(true);
+                const auto result = avx2::transformSplitColumnsMultiThreaded(
+                    matrix, inputVector);
+                setEnabled(false);
+                const auto events = collect();
+
+                THEN("each phase is recorded if tracing is compiled in")
+                {
+                    REQUIRE(result.size() == 13);
+                    for (const auto phase :
+                         {Phase::CALL, Phase::ALLOCATION, Phase::COMPUTE,
+                          Phase::MERGE, Phase::EPILOGUE})
+                    {
+                        REQUIRE(containsPhase(events, phase) == COMPILED_IN);
+                    }
+                }
+            }
+
+            WHEN("transforming with tracing disabled")
+            {
+                avx2::transformMultiThreaded(matrix, inputVector);
+
+                THEN("nothing is recorded")
+                {
+                    REQUIRE(collect().empty());
+                }
+            }
+        }
+    }
+}
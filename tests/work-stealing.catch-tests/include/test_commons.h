@@ -0,0 +1,8 @@
+#pragma once
+
+#include <work-stealing-deque.h>
+#include <work-stealing.h>
+
+#include <catch2/catch.hpp>
+
+#include <omp.h>
@@ -0,0 +1,103 @@
+#include "test_commons.h"
+
+#include <atomic>
+#include <vector>
+
+namespace matrixmultiplication::scheduling
+{
+    SCENARIO("Chase-Lev work-stealing deque")
+    {
+        GIVEN("an empty deque")
+        {
+            WorkStealingDeque<size_t> deque{4};
+
+            THEN("neither pop nor steal takes an item")
+            {
+                REQUIRE(deque.size() == 0);
+                REQUIRE_FALSE(deque.pop().has_value());
+                REQUIRE_FALSE(deque.steal().has_value());
+            }
+
+            WHEN("pushing more items than its initial capacity")
+            {
+                for (size_t i{0}; i < 10; ++i)
+                {
+                    deque.push(i);
+                }
+
+                THEN("it grows and keeps all items")
+                {
+                    REQUIRE(deque.size() == 10);
+                }
+
+                THEN("the owner pops them last in, first out")
+                {
+                    REQUIRE(deque.pop() == size_t{9});
+                    REQUIRE(deque.pop() == size_t{8});
+                }
+
+                THEN("thieves steal them first in, first out")
+                {
+                    REQUIRE(deque.steal() == size_t{0});
+                    REQUIRE(deque.steal() == size_t{1});
+                    REQUIRE(deque.size() == 8);
+                }
+            }
+        }
+
+        GIVEN("a deque that its owner drains while others steal")
+        {
+            const size_t items{100000};
+            WorkStealingDeque<size_t> deque;
+            std::vector<std::atomic<int>> taken(items);
+
+            WHEN("the owner pushes and pops while the other threads steal")
+            {
+                std::atomic<bool> pushed{false};
+
+#pragma omp parallel num_threads(4)
+                {
+                    if (omp_get_thread_num() == 0)
+                    {
+                        for (size_t i{0}; i < items; ++i)
+                        {
+                            deque.push(i);
+                            if (i % 2 == 1)
+                            {
+                                if (auto item = deque.pop())
+                                {
+                                    ++taken[*item];
+                                }
+                            }
+                        }
+                        pushed.store(true);
+                        while (auto item = deque.pop())
+                        {
+                            ++taken[*item];
+                        }
+                    }
+                    else
+                    {
+                        while (!pushed.load() || deque.size() > 0)
+                        {
+                            if (auto item = deque.steal())
+                            {
+                                ++taken[*item];
+                            }
+                        }
+                    }
+                }
+
+                THEN("each item is taken exactly once")
+                {
+                    auto takenOnce = size_t{0};
+                    for (auto && count : taken)
+                    {
+                        takenOnce += count.load() == 1 ? 1 : 0;
+                    }
+                    REQUIRE(takenOnce == items);
+                }
+            }
+        }
+    }
+}
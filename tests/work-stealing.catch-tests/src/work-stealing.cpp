@@ -0,0 +1,72 @@
+#include "test_commons.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace matrixmultiplication::scheduling
+{
+    SCENARIO("Work-stealing scheduler")
+    {
+        GIVEN("no tasks")
+        {
+            WHEN("running them")
+            {
+                auto calls = 0;
+                const auto stats =
+                    runWorkStealing(0, [&](const size_t) { ++calls; });
+
+                THEN("nothing runs")
+                {
+                    REQUIRE(calls == 0);
+                    REQUIRE(stats.tasks == 0);
+                }
+            }
+        }
+
+        GIVEN("tasks of very uneven cost")
+        {
+            const size_t tasks{64};
+            std::vector<std::atomic<int>> runs(tasks);
+
+            WHEN("running them on up to 4 threads")
+            {
+                const auto threads = omp_get_max_threads();
+                omp_set_num_threads(4);
+
+                // The first block of tasks is by far the most expensive, so
+                // that the other workers run empty early.
+                const auto stats = runWorkStealing(tasks, [&](const size_t i) {
+                    if (i < tasks / 4)
+                    {
+                        std::this_thread::sleep_for(
+                            std::chrono::microseconds(200));
+                    }
+                    ++runs[i];
+                });
+                omp_set_num_threads(threads);
+
+                THEN("each task runs exactly once")
+                {
+                    auto ranOnce = size_t{0};
+                    for (auto && count : runs)
+                    {
+                        ranOnce += count.load() == 1 ? 1 : 0;
+                    }
+                    REQUIRE(ranOnce == tasks);
+                    REQUIRE(stats.tasks == tasks);
+                }
+
+                THEN("idle workers steal, if there are other workers")
+                {
+                    REQUIRE(stats.workers >= 1);
+                    if (stats.workers > 1)
+                    {
+                        REQUIRE(stats.steals > 0);
+                    }
+                }
+            }
+        }
+    }
+}